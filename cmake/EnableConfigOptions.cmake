@@ -15,11 +15,18 @@ if (NOT TARGET enable-config-options)
 		OFF
 	)
 
+	# Config option, to provide the mimicpp::compiled target.
+	# That library contains the non-template reporting and printing code, which is then no longer compiled in each
+	# translation-unit.
+	# All consumers must agree on the MIMICPP_CONFIG_COMPILED macro, thus it's defined here.
+	OPTION(MIMICPP_CONFIG_COMPILED "When enabled, the reporting code will be compiled into the mimicpp::compiled library." OFF)
+
 	target_compile_definitions(
 		enable-config-options
 		INTERFACE
 		$<$<BOOL:${MIMICPP_CONFIG_ONLY_PREFIXED_MACROS}>:MIMICPP_CONFIG_ONLY_PREFIXED_MACROS>
 		$<$<BOOL:${MIMICPP_CONFIG_EXPERIMENTAL_CATCH2_MATCHER_INTEGRATION}>:MIMICPP_CONFIG_EXPERIMENTAL_CATCH2_MATCHER_INTEGRATION>
+		$<$<BOOL:${MIMICPP_CONFIG_COMPILED}>:MIMICPP_CONFIG_COMPILED>
 	)
 
 	# Config option, to utilize fmt instead of std formatting.
@@ -100,6 +107,54 @@ if (NOT TARGET enable-config-options)
 
 	endif()
 
+	# Config option, to utilize re2 as backend for the regex string-matchers.
+	# The re2 package must be installed, as it requires abseil and thus is not fetched.
+	# Eventually defines the macro MIMICPP_CONFIG_USE_RE2.
+	OPTION(MIMICPP_CONFIG_USE_RE2 "When enabled, uses re2 instead of std::regex for the regex string-matchers." OFF)
+	if (MIMICPP_CONFIG_USE_RE2)
+
+		message(DEBUG "${MESSAGE_PREFIX} Searching for installed {re2}-package.")
+		find_package(re2 REQUIRED)
+		message(STATUS "${MESSAGE_PREFIX} Using {re2}-package from: ${re2_DIR}")
+		target_link_libraries(
+			enable-config-options
+			INTERFACE
+			re2::re2
+		)
+
+		target_compile_definitions(
+			enable-config-options
+			INTERFACE
+			MIMICPP_CONFIG_USE_RE2
+		)
+
+	endif()
+
+	# Config option, to enable the range-matcher overloads, which accept execution policies.
+	# Eventually defines the macro MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS.
+	OPTION(MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS "When enabled, some range-matchers accept execution policies." OFF)
+	if (MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS)
+
+		# libstdc++ implements the parallel algorithms on top of tbb, other implementations do not require it.
+		message(DEBUG "${MESSAGE_PREFIX} Searching for installed {TBB}-package.")
+		find_package(TBB QUIET)
+		if (TBB_FOUND)
+			message(STATUS "${MESSAGE_PREFIX} Using {TBB}-package from: ${TBB_DIR}")
+			target_link_libraries(
+				enable-config-options
+				INTERFACE
+				TBB::tbb
+			)
+		endif ()
+
+		target_compile_definitions(
+			enable-config-options
+			INTERFACE
+			MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS
+		)
+
+	endif()
+
 	# Config option to enable full stacktrace support.
 	# Eventually defines the macro MIMICPP_CONFIG_EXPERIMENTAL_STACKTRACE.
 	OPTION(MIMICPP_CONFIG_EXPERIMENTAL_STACKTRACE "When enabled, experimental stacktrace feature is enabled (requires either c++23 or cpptrace)." OFF)
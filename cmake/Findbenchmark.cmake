@@ -0,0 +1,18 @@
+#          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+# Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          https://www.boost.org/LICENSE_1_0.txt)
+
+include(get_cpm)
+
+CPMAddPackage(
+	NAME				benchmark
+	VERSION				1.9.1
+	GITHUB_REPOSITORY	google/benchmark
+	EXCLUDE_FROM_ALL	YES
+	SYSTEM				YES
+	OPTIONS
+		"BENCHMARK_ENABLE_TESTING OFF"
+		"BENCHMARK_ENABLE_GTEST_TESTS OFF"
+		"BENCHMARK_ENABLE_INSTALL OFF"
+)
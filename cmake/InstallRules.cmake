@@ -9,11 +9,16 @@ set(MIMICPP_LIB_INSTALL_DIR "${CMAKE_INSTALL_LIBDIR}/mimicpp")
 set(MIMICPP_CMAKE_INSTALL_DIR "${MIMICPP_LIB_INSTALL_DIR}/cmake")
 set(MIMICPP_INCLUDE_INSTALL_DIR "${CMAKE_INSTALL_LIBDIR}/mimicpp")
 
+# The compiled library is architecture specific, thus consumers must then check the architecture.
+if (NOT MIMICPP_CONFIG_COMPILED)
+    set(MIMICPP_ARCH_INDEPENDENT_FLAG ARCH_INDEPENDENT)
+endif()
+
 write_basic_package_version_file(
     "mimicpp-version.cmake"
     VERSION         ${PROJECT_VERSION}
     COMPATIBILITY   AnyNewerVersion
-    ARCH_INDEPENDENT
+    ${MIMICPP_ARCH_INDEPENDENT_FLAG}
 )
 
 configure_package_config_file(
@@ -28,6 +33,32 @@ install(
 	PUBLIC_HEADER DESTINATION	"${MIMICPP_INCLUDE_INSTALL_DIR}"
 )
 
+# The pch target requires at least CMake 3.16.
+if (TARGET mimicpp-pch)
+
+	install(
+		TARGETS				mimicpp-pch
+		EXPORT				mimicpp-targets
+	)
+
+endif()
+
+if (MIMICPP_CONFIG_COMPILED)
+
+	install(
+		TARGETS				mimicpp-compiled
+		EXPORT				mimicpp-targets
+		ARCHIVE DESTINATION	"${CMAKE_INSTALL_LIBDIR}"
+	)
+
+	# Users, who don't use CMake, may compile the source on their own.
+	install(
+		FILES				"${PROJECT_SOURCE_DIR}/src/Reporting.cpp"
+		DESTINATION			"${CMAKE_INSTALL_DATADIR}/mimicpp/src"
+	)
+
+endif()
+
 install(
     DIRECTORY				"include/"
     TYPE					INCLUDE
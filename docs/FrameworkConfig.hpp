@@ -70,6 +70,47 @@
  * to get some feedback, before I'll declare this as a stable feature.
  *
  * ---
+ * \anchor MIMICPP_CONFIG_USE_RE2
+ * ## Use ``re2`` as regex backend
+ * Name: ``MIMICPP_CONFIG_USE_RE2``
+ * \see https://github.com/google/re2
+ *
+ * By default, the \ref MATCHERS_STRING_REGEX "regex matchers" use ``std::regex``, which is known to be rather slow.
+ * When enabled, ``re2`` is used instead, which guarantees linear matching time. Note that ``re2`` doesn't support every
+ * ``ECMAScript`` feature (e.g. back-references).
+ *
+ * As ``re2`` depends on ``abseil``, ``mimic++`` doesn't fetch it. Make sure, that it can be found via ``find_package(re2)``.
+ *
+ * ---
+ * \anchor MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS
+ * ## Enable parallel range-matchers
+ * Name: ``MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS``
+ *
+ * When enabled, the \ref MATCHERS_RANGE "range matchers" ``eq``, ``is_sorted``, ``each_element`` and ``any_element``
+ * additionally accept an execution policy (e.g. ``std::execution::par_unseq``), which is applied on large random-access ranges.
+ * This is disabled by default, as it requires the ``<execution>`` header, which is rather heavy and, depending on the
+ * standard-library, requires linking against an additional library (e.g. ``libstdc++`` requires ``tbb``).
+ *
+ * ``mimic++`` links ``tbb`` automatically, if it can be found via ``find_package(TBB)``.
+ *
+ * ---
+ * \anchor MIMICPP_CONFIG_COMPILED
+ * ## Compile the reporting code just once
+ * Name: ``MIMICPP_CONFIG_COMPILED``
+ *
+ * ``mimic++`` is header-only by default, thus the (rather large) non-template reporting and printing code is compiled
+ * in each translation-unit, just for the linker to throw away all but one copy.
+ * When enabled, the ``mimicpp::compiled`` target is available, which is a static library, that contains that code.
+ * The ``MIMICPP_CONFIG_COMPILED`` macro is then defined for all targets, which link either ``mimicpp::mimicpp`` or
+ * ``mimicpp::compiled``, and lets the headers just declare the affected functions.
+ * ``mimicpp::mimicpp`` therefore links the library, too, and consumers don't need any further changes.
+ * The library is also part of the installed package.
+ *
+ * \attention All translation-units of a program must agree on this setting.
+ * Users, who do not use CMake, must compile ``src/Reporting.cpp`` on their own (which is also installed into
+ * ``share/mimicpp/src``) and define ``MIMICPP_CONFIG_COMPILED`` globally.
+ *
+ * ---
  * \anchor MIMICPP_CONFIG_EXPERIMENTAL_STACKTRACE
  * ## Enable experimental stacktrace support
  * Name: ``MIMICPP_CONFIG_EXPERIMENTAL_STACKTRACE``
@@ -0,0 +1,49 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/mimic++.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+//! [explicit instantiation]
+// These declarations should usually be part of a common header, which is included by each test-file.
+MIMICPP_EXTERN_EXPECTATION_COLLECTION(int(const std::string&, std::vector<int>));
+MIMICPP_EXTERN_PRINTER(std::vector<int>);
+MIMICPP_EXTERN_PRINTER(std::map<int, std::string>);
+
+// These definitions must appear exactly once in the executable, e.g. in a dedicated source-file.
+MIMICPP_INSTANTIATE_EXPECTATION_COLLECTION(int(const std::string&, std::vector<int>));
+MIMICPP_INSTANTIATE_PRINTER(std::vector<int>);
+MIMICPP_INSTANTIATE_PRINTER(std::map<int, std::string>);
+
+//! [explicit instantiation]
+
+TEST_CASE(
+    "Mocks and printers can be explicitly instantiated.",
+    "[example][example::mock]")
+{
+    namespace finally = mimicpp::finally;
+    namespace matches = mimicpp::matches;
+
+    // The mock is a mere frontend, which uses the explicitly instantiated ExpectationCollection.
+    mimicpp::Mock<int(const std::string&, std::vector<int>) const> mock{};
+
+    SCOPED_EXP mock.expect_call("Hello, World!", matches::range::has_size(3u))
+        and finally::returns(42);
+
+    REQUIRE(42 == mock("Hello, World!", {1, 2, 3}));
+
+    const std::vector values{1, 2, 3};
+    REQUIRE("{ 1, 2, 3 }" == mimicpp::print(values));
+
+    const std::map<int, std::string> map{
+        {1, "Hello"}
+    };
+    REQUIRE(R"({ { 1, "Hello" } })" == mimicpp::print(map));
+}
@@ -191,3 +191,50 @@ TEST_CASE(
     use_interfaceB(mock); // calls foo() and the const bar()
                           //! [interface mock multiple inheritance]
 }
+
+TEST_CASE(
+    "Interface mocks can spy on real objects.",
+    "[example][example::mock][example::mock::interface]")
+{
+    //! [interface mock spy]
+    namespace finally = mimicpp::finally;
+
+    class Interface
+    {
+    public:
+        virtual ~Interface() = default;
+        virtual int compute(int value) = 0;
+    };
+
+    class Real
+        : public Interface
+    {
+    public:
+        int compute(const int value) override
+        {
+            return 2 * value;
+        }
+    };
+
+    class Derived
+        : public Interface
+    {
+    public:
+        MOCK_METHOD(compute, int, (int));
+    };
+
+    Real real{};
+    Derived mock{};
+
+    // all calls, which aren't matched by any expectation, are forwarded to the real object
+    const mimicpp::ScopedSpy spy = mock.compute_.spy_on(
+        [&](const int value) { return real.compute(value); });
+    REQUIRE(2 == mock.compute(1));
+
+    // but we are still able to intercept specific calls
+    SCOPED_EXP mock.compute_.expect_call(42)
+        and finally::returns(-1);
+    REQUIRE(-1 == mock.compute(42));
+    REQUIRE(6 == mock.compute(3));
+    //! [interface mock spy]
+}
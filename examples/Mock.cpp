@@ -4,10 +4,18 @@
 //          https://www.boost.org/LICENSE_1_0.txt)
 
 #include "mimic++/Mock.hpp"
+#include "mimic++/matchers/GeneralMatchers.hpp"
 #include "mimic++/policies/FinalizerPolicies.hpp"
+#include "mimic++/policies/SideEffectPolicies.hpp"
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <span>
+#include <string>
+#include <tuple>
+#include <vector>
+
 namespace
 {
     //! [stack concept]
@@ -184,3 +192,78 @@ TEST_CASE(
     }
     //! [test pop]
 }
+
+TEST_CASE(
+    "Mock::expect_each sets up a whole expectation table at once.",
+    "[example][example::mock]")
+{
+    //! [expect_each]
+    namespace expect = mimicpp::expect;
+
+    mimicpp::Mock<int(int, int)> add{};
+
+    std::vector<std::tuple<std::tuple<int, int>, int>> table{};
+    for (int i = 0; i < 1000; ++i)
+    {
+        table.emplace_back(std::tuple{i, i}, i + i);
+    }
+
+    // behaves like 1000 single expectations, but each call is answered via a direct lookup
+    SCOPED_EXP add.expect_each(table);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        REQUIRE(i + i == add(i, i));
+    }
+    //! [expect_each]
+}
+
+TEST_CASE(
+    "ForwardingMock receives large by-value params without copying them.",
+    "[example][example::mock]")
+{
+    //! [forwarding mock]
+    namespace matches = mimicpp::matches;
+
+    // The signature still states by-value, but ForwardingMock doesn't copy the vector before handling the call.
+    mimicpp::ForwardingMock<void(std::vector<int>)> consume{};
+
+    std::vector<int> data(1'000'000, 42);
+    const int* const dataPtr = data.data();
+
+    SCOPED_EXP consume.expect_call(matches::_)
+        and mimicpp::then::apply_arg<0>([&](const std::vector<int>& received) {
+                // the mock observes the callers object
+                REQUIRE(dataPtr == received.data());
+            });
+
+    consume(data);
+    //! [forwarding mock]
+}
+
+TEST_CASE(
+    "Mock::record_calls captures the whole call history.",
+    "[example][example::mock]")
+{
+    //! [call recorder]
+    namespace expect = mimicpp::expect;
+    namespace matches = mimicpp::matches;
+
+    mimicpp::Mock<void(int, const std::string&)> log{};
+    SCOPED_EXP log.expect_call(matches::_, matches::_)
+        and expect::at_least(0);
+
+    // stores just the first argument and the length of the second one (as two separate columns)
+    const mimicpp::CallRecorder recorder = log.record_calls(
+        [](const int severity, const std::string& message) { return std::tuple{severity, message.size()}; });
+
+    for (int i = 0; i < 100'000; ++i)
+    {
+        log(i % 4, "Hello, World!");
+    }
+
+    std::span<const int> severities = recorder.column<0>();
+    REQUIRE(100'000 == std::ranges::count_if(severities, [](const int s) { return s < 4; }));
+    REQUIRE(std::ranges::all_of(recorder.column<1>(), [](const std::size_t len) { return len == 13u; }));
+    //! [call recorder]
+}
@@ -0,0 +1,78 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/Mock.hpp"
+#include "mimic++/Replay.hpp"
+#include "mimic++/matchers/GeneralMatchers.hpp"
+#include "mimic++/policies/ControlPolicies.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace
+{
+    // Just a stand-in for something slow (e.g. a database connection).
+    class Database
+    {
+    public:
+        [[nodiscard]]
+        std::optional<std::string> find_name(const int id) const
+        {
+            if (id < 0)
+            {
+                return std::nullopt;
+            }
+
+            return "User" + std::to_string(id);
+        }
+    };
+}
+
+TEST_CASE(
+    "Calls can be recorded and replayed.",
+    "[example][example::replay]")
+{
+    using SignatureT = std::optional<std::string>(int);
+    const std::filesystem::path tapePath = std::filesystem::temp_directory_path() / "mimicpp-example.tape";
+
+    {
+        //! [record]
+        namespace expect = mimicpp::expect;
+        namespace finally = mimicpp::finally;
+        namespace matches = mimicpp::matches;
+
+        const Database database{};
+        mimicpp::CallTape<SignatureT> tape{};
+
+        mimicpp::Mock<SignatureT> findName{};
+        SCOPED_EXP findName.expect_call(matches::_)
+            and expect::at_least(0)
+            and finally::record_to(tape, [&](const int id) { return database.find_name(id); });
+
+        REQUIRE("User42" == findName(42));
+        REQUIRE(std::nullopt == findName(-1));
+
+        tape.save(tapePath);
+        //! [record]
+    }
+
+    {
+        //! [replay]
+        const auto tape = mimicpp::CallTape<SignatureT>::load(tapePath);
+
+        mimicpp::Mock<SignatureT> findName{};
+        // each recorded call is expected exactly once
+        SCOPED_EXP findName.expect_each(tape.replay_rows());
+
+        REQUIRE("User42" == findName(42));
+        REQUIRE(std::nullopt == findName(-1));
+        //! [replay]
+    }
+
+    std::filesystem::remove(tapePath);
+}
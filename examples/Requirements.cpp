@@ -5,6 +5,7 @@
 
 #include "mimic++/Mock.hpp"
 #include "mimic++/matchers/RangeMatchers.hpp"
+#include "mimic++/matchers/RegexMatchers.hpp"
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -247,3 +248,39 @@ TEST_CASE(
     mock("Hello, World!");
     //! [matcher str matcher]
 }
+
+TEST_CASE(
+    "String literals can be matched without any runtime overhead.",
+    "[example][example::requirements]")
+{
+    //! [matcher str literal]
+    namespace matches = mimicpp::matches;
+
+    mimicpp::Mock<void(std::string)> mock{};
+
+    // the pattern is a template-argument, thus the matcher is fully built during compile-time
+    SCOPED_EXP mock.expect_call(matches::str::eq<"Hello, World!">());
+    SCOPED_EXP mock.expect_call(!matches::str::contains<"World">());
+
+    mock("Hello, World!");
+    mock("Hello, Me!");
+    //! [matcher str literal]
+}
+
+TEST_CASE(
+    "Strings can be matched against regular expressions.",
+    "[example][example::requirements]")
+{
+    //! [matcher str regex]
+    namespace matches = mimicpp::matches;
+
+    mimicpp::Mock<void(std::string)> mock{};
+
+    // the expression is compiled once, when the matcher is created
+    SCOPED_EXP mock.expect_call(matches::str::regex(R"(\w+, \w+!)"));
+    SCOPED_EXP mock.expect_call(matches::str::regex("hello", mimicpp::case_insensitive));
+
+    mock("Hello, World!");
+    mock("HeLlO");
+    //! [matcher str regex]
+}
@@ -0,0 +1,511 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MIMICPP_CALL_RECORDER_HPP
+#define MIMICPP_CALL_RECORDER_HPP
+
+#pragma once
+
+#include "mimic++/Call.hpp"
+#include "mimic++/Expectation.hpp"
+#include "mimic++/Fwd.hpp"
+#include "mimic++/TypeTraits.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mimicpp::detail
+{
+    /**
+     * \brief The default projection of ``CallRecorder``, which simply copies all arguments.
+     */
+    struct copy_args_fn
+    {
+        template <typename... Args>
+        [[nodiscard]]
+        constexpr std::tuple<std::remove_cvref_t<Args>...> operator()(const Args&... args) const
+        {
+            return std::tuple<std::remove_cvref_t<Args>...>{args...};
+        }
+    };
+
+    /**
+     * \brief Contiguous storage for ``bool`` columns.
+     * \details ``std::vector<bool>`` packs its elements into bits and can thus not be viewed as a ``std::span<const bool>``.
+     * This type just provides the subset of the ``std::vector`` interface, which is required by ``CallLog``.
+     */
+    class bool_column
+    {
+    public:
+        using value_type = bool;
+
+        [[nodiscard]]
+        bool_column() = default;
+
+        bool_column(const bool_column&) = delete;
+        bool_column& operator=(const bool_column&) = delete;
+
+        [[nodiscard]]
+        bool_column(bool_column&& other) noexcept
+            : m_Data{std::move(other.m_Data)},
+              m_Size{std::exchange(other.m_Size, 0u)},
+              m_Capacity{std::exchange(other.m_Capacity, 0u)}
+        {
+        }
+
+        bool_column& operator=(bool_column&& other) noexcept
+        {
+            m_Data = std::move(other.m_Data);
+            m_Size = std::exchange(other.m_Size, 0u);
+            m_Capacity = std::exchange(other.m_Capacity, 0u);
+
+            return *this;
+        }
+
+        [[nodiscard]]
+        const bool* data() const noexcept
+        {
+            return m_Data.get();
+        }
+
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return m_Size;
+        }
+
+        [[nodiscard]]
+        const bool* begin() const noexcept
+        {
+            return m_Data.get();
+        }
+
+        [[nodiscard]]
+        const bool* end() const noexcept
+        {
+            return m_Data.get() + m_Size;
+        }
+
+        void reserve(const std::size_t capacity)
+        {
+            if (m_Capacity < capacity)
+            {
+                reallocate(capacity);
+            }
+        }
+
+        void emplace_back(const bool value)
+        {
+            if (m_Size == m_Capacity)
+            {
+                reallocate(std::max<std::size_t>(8u, 2u * m_Capacity));
+            }
+
+            m_Data[m_Size] = value;
+            ++m_Size;
+        }
+
+        void erase(const bool* const first, [[maybe_unused]] const bool* const last) noexcept
+        {
+            assert(last == end() && "Only the tail can be erased.");
+
+            m_Size = static_cast<std::size_t>(first - begin());
+        }
+
+    private:
+        std::unique_ptr<bool[]> m_Data{};
+        std::size_t m_Size{};
+        std::size_t m_Capacity{};
+
+        void reallocate(const std::size_t capacity)
+        {
+            auto data = std::make_unique_for_overwrite<bool[]>(capacity);
+            std::copy(begin(), end(), data.get());
+            m_Data = std::move(data);
+            m_Capacity = capacity;
+        }
+    };
+
+    template <typename T>
+    struct recorder_column
+    {
+        using type = std::vector<T>;
+    };
+
+    template <>
+    struct recorder_column<bool>
+    {
+        using type = bool_column;
+    };
+
+    template <typename Record>
+    struct recorder_columns
+    {
+        using record_t = std::tuple<Record>;
+        using type = std::tuple<typename recorder_column<Record>::type>;
+    };
+
+    template <typename... Elements>
+    struct recorder_columns<std::tuple<Elements...>>
+    {
+        using record_t = std::tuple<Elements...>;
+        using type = std::tuple<typename recorder_column<Elements>::type...>;
+    };
+
+    template <typename Projection, typename ParamList>
+    struct projected_record;
+
+    template <typename Projection, typename... Params>
+    struct projected_record<Projection, type_list<Params...>>
+    {
+        using type = std::remove_cvref_t<
+            std::invoke_result_t<const Projection&, const std::remove_reference_t<Params>&...>>;
+    };
+
+    template <typename Projection, typename Signature>
+    using projected_record_t = typename projected_record<Projection, signature_param_list_t<Signature>>::type;
+
+    template <typename Signature, typename Projection>
+    class CallLog final
+        : public CallObserver<Signature>
+    {
+    public:
+        using CallInfoT = call::info_for_signature_t<Signature>;
+        using ColumnsT = typename recorder_columns<projected_record_t<Projection, Signature>>::type;
+        using ClockT = std::chrono::steady_clock;
+
+        [[nodiscard]]
+        explicit CallLog(Projection projection) noexcept(std::is_nothrow_move_constructible_v<Projection>)
+            : m_Projection{std::move(projection)}
+        {
+        }
+
+        void observe(const CallInfoT& call) override
+        {
+            const std::size_t size = m_Timestamps.size();
+            try
+            {
+                m_Timestamps.emplace_back(ClockT::now());
+                m_ThreadIds.emplace_back(std::this_thread::get_id());
+                append_record(project(call.args));
+            }
+            catch (...)
+            {
+                // keep all columns at the same length
+                truncate(size);
+                throw;
+            }
+        }
+
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return m_Timestamps.size();
+        }
+
+        void reserve(const std::size_t capacity)
+        {
+            m_Timestamps.reserve(capacity);
+            m_ThreadIds.reserve(capacity);
+            std::apply(
+                [&](auto&... columns) { (..., columns.reserve(capacity)); },
+                m_Columns);
+        }
+
+        void clear() noexcept
+        {
+            truncate(0u);
+        }
+
+        [[nodiscard]]
+        const ColumnsT& columns() const noexcept
+        {
+            return m_Columns;
+        }
+
+        [[nodiscard]]
+        const std::vector<ClockT::time_point>& timestamps() const noexcept
+        {
+            return m_Timestamps;
+        }
+
+        [[nodiscard]]
+        const std::vector<std::thread::id>& thread_ids() const noexcept
+        {
+            return m_ThreadIds;
+        }
+
+    private:
+        [[no_unique_address]] Projection m_Projection;
+        std::vector<ClockT::time_point> m_Timestamps{};
+        std::vector<std::thread::id> m_ThreadIds{};
+        ColumnsT m_Columns{};
+
+        template <typename... Args>
+        [[nodiscard]]
+        constexpr auto project(const std::tuple<Args...>& args) const
+        {
+            return std::apply(
+                [this](auto&... refs) {
+                    return std::invoke(m_Projection, std::as_const(refs.get())...);
+                },
+                args);
+        }
+
+        template <typename Record>
+        void append_record(Record&& record)
+        {
+            using RecordT = std::remove_cvref_t<Record>;
+
+            if constexpr (std::same_as<RecordT, typename recorder_columns<RecordT>::record_t>)
+            {
+                std::invoke(
+                    [&]<std::size_t... indices>([[maybe_unused]] const std::index_sequence<indices...>) {
+                        (...,
+                         std::get<indices>(m_Columns).emplace_back(std::get<indices>(std::forward<Record>(record))));
+                    },
+                    std::make_index_sequence<std::tuple_size_v<RecordT>>{});
+            }
+            else
+            {
+                std::get<0>(m_Columns).emplace_back(std::forward<Record>(record));
+            }
+        }
+
+        void truncate(const std::size_t size) noexcept
+        {
+            const auto shrink = [&](auto& column) {
+                if (size < column.size())
+                {
+                    column.erase(column.begin() + static_cast<std::ptrdiff_t>(size), column.end());
+                }
+            };
+
+            shrink(m_Timestamps);
+            shrink(m_ThreadIds);
+            std::apply(
+                [&](auto&... columns) { (..., shrink(columns)); },
+                m_Columns);
+        }
+    };
+}
+
+namespace mimicpp
+{
+    /**
+     * \defgroup CALL_RECORDER call recorder
+     * \ingroup MOCK
+     * \brief Call recorders capture the whole call history of a mock, so that assertions can be made afterwards.
+     * \details Expectations are great to specify, what should happen, but they become infeasible, when millions of calls
+     * have to be verified or when the exact sequence is only known after the fact.
+     * A ``CallRecorder`` can be attached to any signature of a ``Mock`` (and thus to every mocked method of interface-mocks)
+     * and appends every incoming call to a compact struct-of-arrays log.
+     *
+     * By default, all arguments are copied. Alternatively, a projection can be provided, which receives all arguments as
+     * const references and returns either a single value or a ``std::tuple``; each tuple-element then forms its own column.
+     * Besides that, the timestamp and the id of the calling thread is stored.
+     * No strings are formatted during the recording.
+     *
+     * All columns can be accessed as ``std::span``s.
+     * \snippet Mock.cpp call recorder
+     *
+     * \note The recorder just observes calls; it neither participates in the matching, nor satisfies any expectation.
+     * All calls are still required to match any expectation.
+     * \attention Appending is synchronized with other calls to the same mock-signature, but reading the log while another
+     * thread invokes the mock is not.
+     *
+     * \{
+     */
+
+    /**
+     * \brief Records each call of a specific mock-signature into a columnar log.
+     * \tparam Signature The decayed signature.
+     * \tparam Projection The projection type, which is applied on the arguments.
+     * \details The recording starts with the construction and ends with the destruction of the recorder.
+     * \attention A moved-from recorder does not own a log anymore. It must not be accessed, until a new recorder has
+     * been assigned to it.
+     */
+    template <typename Signature, typename Projection = detail::copy_args_fn>
+        requires std::same_as<Signature, signature_decay_t<Signature>>
+    class CallRecorder
+    {
+    public:
+        /**
+         * \brief The type of a single record.
+         * \details Projections which return a ``std::tuple`` are split into multiple columns.
+         */
+        using RecordT = detail::projected_record_t<Projection, Signature>;
+
+        /**
+         * \brief The clock, which is used for the timestamps.
+         */
+        using ClockT = std::chrono::steady_clock;
+
+        /**
+         * \brief Detaches from the mock.
+         */
+        ~CallRecorder() noexcept
+        {
+            if (m_Collection)
+            {
+                m_Collection->detach(m_Log);
+            }
+        }
+
+        /**
+         * \brief Attaches a new recorder to the given collection.
+         * \param collection The collection to be observed.
+         * \param projection The projection to be applied on the arguments.
+         * \note Users should prefer the ``record_calls`` member function of mocks.
+         */
+        [[nodiscard]]
+        explicit CallRecorder(
+            std::shared_ptr<ExpectationCollection<Signature>> collection,
+            Projection projection = Projection{})
+            : m_Collection{std::move(collection)},
+              m_Log{std::make_shared<LogT>(std::move(projection))}
+        {
+            assert(m_Collection && "Collection is nullptr.");
+
+            m_Collection->attach(m_Log);
+        }
+
+        /**
+         * \brief Deleted copy-constructor.
+         */
+        CallRecorder(const CallRecorder&) = delete;
+
+        /**
+         * \brief Deleted copy-assignment-operator.
+         */
+        CallRecorder& operator=(const CallRecorder&) = delete;
+
+        /**
+         * \brief Defaulted move-constructor.
+         * \details The source recorder is left without any log.
+         */
+        [[nodiscard]]
+        CallRecorder(CallRecorder&&) = default;
+
+        /**
+         * \brief Move-assignment-operator, which detaches the current log first.
+         * \details The source recorder is left without any log.
+         */
+        CallRecorder& operator=(CallRecorder&& other) noexcept
+        {
+            if (this != std::addressof(other))
+            {
+                if (m_Collection)
+                {
+                    m_Collection->detach(m_Log);
+                }
+
+                m_Collection = std::exchange(other.m_Collection, nullptr);
+                m_Log = std::exchange(other.m_Log, nullptr);
+            }
+
+            return *this;
+        }
+
+        /**
+         * \brief Returns the amount of recorded calls.
+         */
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return log().size();
+        }
+
+        /**
+         * \brief Returns, whether no calls have been recorded yet.
+         */
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return 0u == log().size();
+        }
+
+        /**
+         * \brief Reserves storage for the given amount of calls.
+         * \param capacity The capacity to be reserved.
+         */
+        void reserve(const std::size_t capacity)
+        {
+            log().reserve(capacity);
+        }
+
+        /**
+         * \brief Discards all recorded calls.
+         */
+        void clear() noexcept
+        {
+            log().clear();
+        }
+
+        /**
+         * \brief Returns a view of the specified column.
+         * \tparam index The column index.
+         * \return A span over all recorded values of that column; one element per call.
+         */
+        template <std::size_t index>
+        [[nodiscard]]
+        auto column() const noexcept
+        {
+            using ColumnT = std::tuple_element_t<index, typename LogT::ColumnsT>;
+            return std::span<const typename ColumnT::value_type>{std::get<index>(log().columns())};
+        }
+
+        /**
+         * \brief Returns a view of the timestamps.
+         * \return A span over all recorded timestamps; one element per call.
+         */
+        [[nodiscard]]
+        std::span<const ClockT::time_point> timestamps() const noexcept
+        {
+            return std::span{log().timestamps()};
+        }
+
+        /**
+         * \brief Returns a view of the thread-ids.
+         * \return A span over all recorded thread-ids; one element per call.
+         */
+        [[nodiscard]]
+        std::span<const std::thread::id> thread_ids() const noexcept
+        {
+            return std::span{log().thread_ids()};
+        }
+
+    private:
+        using LogT = detail::CallLog<Signature, Projection>;
+
+        std::shared_ptr<ExpectationCollection<Signature>> m_Collection;
+        std::shared_ptr<LogT> m_Log;
+
+        [[nodiscard]]
+        LogT& log() const noexcept
+        {
+            assert(m_Log && "Recorder is in moved-from state.");
+
+            return *m_Log;
+        }
+    };
+
+    /**
+     * \}
+     */
+}
+
+#endif
@@ -13,6 +13,7 @@
 #include "mimic++/Sequence.hpp"
 #include "mimic++/TypeTraits.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <concepts>
 #include <functional>
@@ -46,6 +47,23 @@ namespace mimicpp::detail
         return std::nullopt;
     }
 
+    template <typename Return, typename... Params, typename Signature>
+    [[nodiscard]]
+    bool is_matching(
+        const call::Info<Return, Params...>& call,
+        const Expectation<Signature>& expectation) noexcept
+    {
+        try
+        {
+            return expectation.is_matching(call);
+        }
+        catch (...)
+        {
+            // Treat it as a (potential) match, so that the exception gets properly reported during the full matching.
+            return true;
+        }
+    }
+
     template <typename Signature>
     constexpr auto pick_best_match(std::vector<std::tuple<Expectation<Signature>&, MatchReport>>& matches)
     {
@@ -170,6 +188,19 @@ namespace mimicpp
         [[nodiscard]]
         virtual MatchReport matches(const CallInfoT& call) const = 0;
 
+        /**
+         * \brief Queries all policies, whether they accept the given call, without generating any report.
+         * \param call The call to be matched.
+         * \return Returns true, if all policies accept the call (regardless of the current control state).
+         * \details This is used on hot paths (e.g. by spies), where reports are just wasted effort.
+         * The default implementation falls back to ``matches``, but implementations are encouraged to override this.
+         */
+        [[nodiscard]]
+        virtual bool is_matching(const CallInfoT& call) const
+        {
+            return MatchResult::none != evaluate_match_report(matches(call));
+        }
+
         /**
          * \brief Informs all policies, that the given call has been accepted.
          * \param call The call to be consumed.
@@ -194,6 +225,121 @@ namespace mimicpp
         virtual constexpr const std::source_location& from() const noexcept = 0;
     };
 
+    /**
+     * \brief The base interface for call-observers.
+     * \tparam Signature The decayed signature.
+     * \details Observers are notified about every incoming call of an ExpectationCollection, before any expectation is queried.
+     * They have no influence on the call handling.
+     * \note Notifications are serialized per ExpectationCollection.
+     */
+    template <typename Signature>
+        requires std::same_as<Signature, signature_decay_t<Signature>>
+    class CallObserver
+    {
+    public:
+        /**
+         * \brief The observed call type.
+         */
+        using CallInfoT = call::info_for_signature_t<Signature>;
+
+        /**
+         * \brief Defaulted virtual destructor.
+         */
+        virtual ~CallObserver() = default;
+
+        /**
+         * \brief Defaulted default constructor.
+         */
+        [[nodiscard]]
+        CallObserver() = default;
+
+        /**
+         * \brief Deleted copy-constructor.
+         */
+        CallObserver(const CallObserver&) = delete;
+
+        /**
+         * \brief Deleted copy-assignment-operator.
+         */
+        CallObserver& operator=(const CallObserver&) = delete;
+
+        /**
+         * \brief Deleted move-constructor.
+         */
+        CallObserver(CallObserver&&) = delete;
+
+        /**
+         * \brief Deleted move-assignment-operator.
+         */
+        CallObserver& operator=(CallObserver&&) = delete;
+
+        /**
+         * \brief Notifies the observer about the incoming call.
+         * \param call The call to be observed.
+         */
+        virtual void observe(const CallInfoT& call) = 0;
+    };
+
+    /**
+     * \brief The base interface for call-fallbacks.
+     * \tparam Signature The decayed signature.
+     * \details A fallback receives all calls of an ExpectationCollection, which aren't matched by any expectation.
+     */
+    template <typename Signature>
+        requires std::same_as<Signature, signature_decay_t<Signature>>
+    class CallFallback
+    {
+    public:
+        /**
+         * \brief The call type.
+         */
+        using CallInfoT = call::info_for_signature_t<Signature>;
+
+        /**
+         * \brief The return type.
+         */
+        using ReturnT = signature_return_type_t<Signature>;
+
+        /**
+         * \brief Defaulted virtual destructor.
+         */
+        virtual ~CallFallback() = default;
+
+        /**
+         * \brief Defaulted default constructor.
+         */
+        [[nodiscard]]
+        CallFallback() = default;
+
+        /**
+         * \brief Deleted copy-constructor.
+         */
+        CallFallback(const CallFallback&) = delete;
+
+        /**
+         * \brief Deleted copy-assignment-operator.
+         */
+        CallFallback& operator=(const CallFallback&) = delete;
+
+        /**
+         * \brief Deleted move-constructor.
+         */
+        CallFallback(CallFallback&&) = delete;
+
+        /**
+         * \brief Deleted move-assignment-operator.
+         */
+        CallFallback& operator=(CallFallback&&) = delete;
+
+        /**
+         * \brief Handles the unmatched call.
+         * \param call The call to be handled. The arguments may be forwarded as-is.
+         * \return The call result.
+         */
+        [[nodiscard]]
+        virtual ReturnT handle_call(const CallInfoT& call) = 0;
+    };
+
     /**
      * \brief Collects all expectations for a specific (decayed) signature.
      * \tparam Signature The decayed signature.
@@ -289,14 +435,71 @@ namespace mimicpp
             }
         }
 
+        /**
+         * \brief Attaches the given observer.
+         * \param observer The observer to be attached.
+         * \attention Attaching an observer, which is already attached to this collection, is undefined behavior.
+         */
+        void attach(std::shared_ptr<CallObserver<Signature>> observer)
+        {
+            const std::scoped_lock lock{m_ExpectationsMx};
+
+            assert(
+                std::ranges::find(m_Observers, observer) == std::ranges::end(m_Observers)
+                && "Observer already attached.");
+
+            m_Observers.emplace_back(std::move(observer));
+        }
+
+        /**
+         * \brief Detaches the given observer.
+         * \param observer The observer to be detached.
+         * \attention Detaching an observer, which is not attached to this collection, is undefined behavior.
+         */
+        void detach(const std::shared_ptr<CallObserver<Signature>>& observer)
+        {
+            const std::scoped_lock lock{m_ExpectationsMx};
+
+            auto iter = std::ranges::find(m_Observers, observer);
+            assert(iter != std::ranges::end(m_Observers) && "Observer is not attached.");
+            m_Observers.erase(iter);
+        }
+
+        /**
+         * \brief Installs the given fallback, which receives all calls not matched by any expectation.
+         * \param fallback The fallback to be installed.
+         * \attention Installing a fallback, while another one is already installed, is undefined behavior.
+         */
+        void set_fallback(std::shared_ptr<CallFallback<Signature>> fallback)
+        {
+            const std::scoped_lock lock{m_ExpectationsMx};
+
+            assert(!m_Fallback && "Fallback already installed.");
+            m_Fallback = std::move(fallback);
+        }
+
+        /**
+         * \brief Uninstalls the current fallback.
+         */
+        void reset_fallback() noexcept
+        {
+            const std::scoped_lock lock{m_ExpectationsMx};
+
+            m_Fallback.reset();
+        }
+
         /**
          * \brief Handles the incoming call.
          * \param call The call to be handled.
          * \return Returns an appropriate result from the matched expectation.
-         * \details This function queries all stored expectations, whether they accept the call.
+         * \details At first, all attached observers are notified about the call.
+         * Afterwards, this function queries all stored expectations, whether they accept the call.
          * If multiple matches are possible, the best match is selected and a "matched"-report is emitted.
          * If no matches are found, "no matched"-report is emitted and the call is aborted (e.g. by throwing an exception or terminating).
          * If matches are possible, but all expectations are saturated, an "inapplicable match"-report is emitted.
+         *
+         * If a fallback is installed and no expectation matches the call (regardless of saturation), the call is handed over
+         * to the fallback instead; no reports are generated at all.
          */
         [[nodiscard]]
         ReturnT handle_call(CallInfoT call)
@@ -305,31 +508,58 @@ namespace mimicpp
             std::vector<MatchReport> noMatches{};
             std::vector<MatchReport> inapplicableMatches{};
 
-            for (const std::scoped_lock lock{m_ExpectationsMx};
-                 auto& exp : m_Expectations | std::views::reverse)
+            std::shared_ptr<CallFallback<Signature>> fallback{};
+
             {
-                if (std::optional matchReport = detail::make_match_report(call, *exp))
+                const std::scoped_lock lock{m_ExpectationsMx};
+
+                for (auto& observer : m_Observers)
+                {
+                    observer->observe(call);
+                }
+
+                if (m_Fallback
+                    && std::ranges::none_of(
+                        m_Expectations,
+                        [&](const auto& exp) { return detail::is_matching(call, *exp); }))
+                {
+                    fallback = m_Fallback;
+                }
+                else
                 {
-                    switch (evaluate_match_report(*matchReport))
+                    // Expectations often share the same (large) objects, which then just need to be printed once.
+                    const detail::PrintCacheScope printCache{};
+                    for (auto& exp : m_Expectations | std::views::reverse)
                     {
-                        using enum MatchResult;
-                    case none:
-                        noMatches.emplace_back(*std::move(matchReport));
-                        break;
-                    case inapplicable:
-                        inapplicableMatches.emplace_back(*std::move(matchReport));
-                        break;
-                    case full:
-                        matches.emplace_back(*exp, *std::move(matchReport));
-                        break;
-                    // GCOVR_EXCL_START
-                    default:
-                        unreachable();
-                        // GCOVR_EXCL_STOP
+                        if (std::optional matchReport = detail::make_match_report(call, *exp))
+                        {
+                            switch (evaluate_match_report(*matchReport))
+                            {
+                                using enum MatchResult;
+                            case none:
+                                noMatches.emplace_back(*std::move(matchReport));
+                                break;
+                            case inapplicable:
+                                inapplicableMatches.emplace_back(*std::move(matchReport));
+                                break;
+                            case full:
+                                matches.emplace_back(*exp, *std::move(matchReport));
+                                break;
+                            // GCOVR_EXCL_START
+                            default:
+                                unreachable();
+                                // GCOVR_EXCL_STOP
+                            }
+                        }
                     }
                 }
             }
 
+            if (fallback)
+            {
+                return fallback->handle_call(call);
+            }
+
             if (!std::ranges::empty(matches))
             {
                 auto&& [exp, report] = *detail::pick_best_match(matches);
@@ -345,21 +575,30 @@ namespace mimicpp
                 return exp.finalize_call(call);
             }
 
-            if (!std::ranges::empty(inapplicableMatches))
-            {
-                detail::report_inapplicable_matches(
-                    make_call_report(std::move(call)),
-                    std::move(inapplicableMatches));
-            }
-
-            detail::report_no_matches(
-                make_call_report(std::move(call)),
-                std::move(noMatches));
+            report_unmatched(
+                std::move(call),
+                std::move(noMatches),
+                std::move(inapplicableMatches));
         }
 
     private:
         std::vector<std::shared_ptr<ExpectationT>> m_Expectations{};
+        std::vector<std::shared_ptr<CallObserver<Signature>>> m_Observers{};
+        std::shared_ptr<CallFallback<Signature>> m_Fallback{};
         std::mutex m_ExpectationsMx{};
+
+        // Outlined from handle_call, as this is just executed on failures.
+        [[noreturn]]
+        MIMICPP_DETAIL_COLD static void report_unmatched(
+            CallInfoT&& call,
+            std::vector<MatchReport>&& noMatches,
+            std::vector<MatchReport>&& inapplicableMatches)
+        {
+            detail::report_unmatched_call(
+                make_call_report(std::move(call)),
+                std::move(noMatches),
+                std::move(inapplicableMatches));
+        }
     };
 
     /**
@@ -502,6 +741,19 @@ namespace mimicpp
                     m_Policies)};
         }
 
+        /**
+         * \copydoc Expectation::is_matching
+         */
+        [[nodiscard]]
+        bool is_matching(const CallInfoT& call) const override
+        {
+            return std::apply(
+                [&](const auto&... policies) {
+                    return (... && policies.matches(call));
+                },
+                m_Policies);
+        }
+
         /**
          * \copydoc Expectation::consume
          */
@@ -542,13 +794,13 @@ namespace mimicpp
         [[nodiscard]]
         StringT describe_times() const
         {
-            StringStreamT ss{};
+            PrintBufferT buffer{};
             std::visit(
                 std::bind_front(
                     detail::control_state_printer{},
-                    std::ostreambuf_iterator{ss}),
+                    PrintIteratorT{buffer}),
                 m_ControlPolicy.state());
-            return std::move(ss).str();
+            return detail::to_print_string(std::move(buffer));
         }
     };
 
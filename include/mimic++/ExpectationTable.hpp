@@ -0,0 +1,569 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MIMICPP_EXPECTATION_TABLE_HPP
+#define MIMICPP_EXPECTATION_TABLE_HPP
+
+#pragma once
+
+#include "mimic++/Expectation.hpp"
+#include "mimic++/Fwd.hpp"
+#include "mimic++/Printer.hpp"
+#include "mimic++/Reports.hpp"
+#include "mimic++/TypeTraits.hpp"
+#include "mimic++/policies/ControlPolicies.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <source_location>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mimicpp::detail
+{
+    template <typename T>
+    concept hashable = requires(const T& value) {
+        { std::hash<T>{}(value) } -> std::convertible_to<std::size_t>;
+    };
+
+    [[nodiscard]]
+    constexpr std::size_t hash_combine(const std::size_t seed, const std::size_t hash) noexcept
+    {
+        return seed ^ (hash + 0x9e3779b9u + (seed << 6u) + (seed >> 2u));
+    }
+
+    /**
+     * \brief Determines, how rows of an expectation table are looked up.
+     */
+    enum class table_lookup
+    {
+        hashed,
+        sorted,
+        linear
+    };
+
+    template <typename ParamList>
+    struct table_traits;
+
+    template <typename... Params>
+    struct table_traits<type_list<Params...>>
+    {
+        using key_t = std::tuple<std::remove_cvref_t<Params>...>;
+        using key_ref_t = std::tuple<const std::remove_cvref_t<Params>&...>;
+
+        static constexpr bool isComparable = (... && std::equality_comparable<std::remove_cvref_t<Params>>);
+
+        static constexpr table_lookup lookup = std::invoke([] {
+            if constexpr ((... && hashable<std::remove_cvref_t<Params>>))
+            {
+                return table_lookup::hashed;
+            }
+            else if constexpr ((... && std::totally_ordered<std::remove_cvref_t<Params>>))
+            {
+                return table_lookup::sorted;
+            }
+            else
+            {
+                return table_lookup::linear;
+            }
+        });
+
+        template <typename Tuple>
+        [[nodiscard]]
+        static constexpr std::size_t hash(const Tuple& key)
+        {
+            return std::apply(
+                [](const auto&... elements) {
+                    std::size_t seed{};
+                    (...,
+                     (seed = hash_combine(
+                          seed,
+                          std::hash<std::remove_cvref_t<decltype(elements)>>{}(elements))));
+                    return seed;
+                },
+                key);
+        }
+
+        template <typename ArgList>
+        [[nodiscard]]
+        static constexpr key_ref_t as_key_ref(const ArgList& args) noexcept
+        {
+            return std::apply(
+                [](const auto&... refs) noexcept {
+                    return key_ref_t{refs.get()...};
+                },
+                args);
+        }
+    };
+
+    template <typename Signature>
+    using table_traits_for = table_traits<signature_param_list_t<Signature>>;
+
+    template <typename Row>
+    concept table_row_like = requires {
+        { std::tuple_size<std::remove_cvref_t<Row>>::value } -> std::convertible_to<std::size_t>;
+    } && 2u == std::tuple_size_v<std::remove_cvref_t<Row>>;
+
+    template <typename Row>
+    using table_row_key_t = decltype(std::get<0>(std::declval<Row>()));
+
+    template <typename Row>
+    using table_row_value_t = std::remove_cvref_t<decltype(std::get<1>(std::declval<Row>()))>;
+}
+
+namespace mimicpp
+{
+    /**
+     * \brief Determines, whether the given range can be used as row-source for an expectation table of the given signature.
+     * \ingroup EXPECTATION_TABLE
+     * \details Each row must be tuple-like with exactly two elements, where the first one denotes the expected arguments
+     * (as tuple, or as plain value for single-parameter signatures) and the second one denotes either a value (which is returned)
+     * or an action (which is invoked with the ``call::Info``).
+     */
+    template <typename Rows, typename Signature>
+    concept table_rows_for =
+        std::ranges::input_range<Rows>
+        && detail::table_traits_for<Signature>::isComparable
+        && detail::table_row_like<std::ranges::range_reference_t<Rows>>
+        && std::constructible_from<
+            typename detail::table_traits_for<Signature>::key_t,
+            detail::table_row_key_t<std::ranges::range_reference_t<Rows>>>
+        && std::copy_constructible<detail::table_row_value_t<std::ranges::range_reference_t<Rows>>>;
+
+    /**
+     * \defgroup EXPECTATION_TABLE expectation table
+     * \ingroup EXPECTATION
+     * \brief Table-backed expectations, which map a (possibly huge) set of argument tuples onto results.
+     * \details Setting up thousands of expectations in a loop works, but each call has to probe every single one of them.
+     * An expectation table behaves like one expectation per row, but looks up the matching row directly:
+     * - via hashing, if all parameter types are hashable (i.e. ``std::hash`` is specialized),
+     * - via binary-search, if all parameter types are totally ordered,
+     * - via linear search otherwise.
+     *
+     * Each row maintains its own ``times`` state, which is set up via the optional times argument (defaults to ``once``).
+     * The whole table is satisfied, when all of its rows are satisfied.
+     * If multiple rows contain the same arguments, the latest one is preferred, as long as it's not saturated.
+     *
+     * Tables are created via the ``expect_each`` member function of ``Mock``.
+     * \snippet Mock.cpp expect_each
+     *
+     * \note Expectation tables do not support sequences.
+     * \{
+     */
+
+    /**
+     * \brief Expectation, which answers calls from a pre-indexed table.
+     * \tparam Signature The decayed signature.
+     * \tparam Value The row value type.
+     * \tparam Policies Additional expectation-policies (e.g. category and constness checks).
+     */
+    template <typename Signature, std::copy_constructible Value, expectation_policy_for<Signature>... Policies>
+    class TableExpectation final
+        : public Expectation<Signature>
+    {
+    public:
+        using CallInfoT = call::info_for_signature_t<Signature>;
+        using ReturnT = typename Expectation<Signature>::ReturnT;
+        using TraitsT = detail::table_traits_for<Signature>;
+        using KeyT = typename TraitsT::key_t;
+        using KeyRefT = typename TraitsT::key_ref_t;
+        using PolicyListT = std::tuple<Policies...>;
+
+        /**
+         * \brief The lookup strategy, which will be used for this table.
+         */
+        static constexpr detail::table_lookup lookup = TraitsT::lookup;
+
+        static_assert(
+            std::invocable<Value&, const CallInfoT&>
+                || std::is_void_v<ReturnT>
+                || explicitly_convertible_to<std::unwrap_reference_t<Value>&, ReturnT>,
+            "Table values must either be invocable with the call-info or be convertible to the return type.");
+
+        /**
+         * \brief Constructs the table from the given rows.
+         * \tparam Rows The row range type.
+         * \param sourceLocation The source-location, where the construction has been requested from.
+         * \param rows The rows.
+         * \param timesConfig The times config, which is applied on every row.
+         * \param policies Additional expectation-policies.
+         */
+        template <table_rows_for<Signature> Rows>
+        [[nodiscard]]
+        explicit TableExpectation(
+            const std::source_location& sourceLocation,
+            Rows&& rows,
+            const detail::TimesConfig& timesConfig,
+            Policies... policies)
+            : m_SourceLocation{sourceLocation},
+              m_Min{timesConfig.min()},
+              m_Max{timesConfig.max()},
+              m_Policies{std::move(policies)...}
+        {
+            if constexpr (std::ranges::sized_range<Rows>)
+            {
+                m_Rows.reserve(std::ranges::size(rows));
+            }
+
+            for (auto&& row : rows)
+            {
+                auto& inserted = m_Rows.emplace_back(
+                    Row{
+                        .hash = {},
+                        .key = KeyT(std::get<0>(std::forward<decltype(row)>(row))),
+                        .value = Value(std::get<1>(std::forward<decltype(row)>(row)))});
+
+                if constexpr (detail::table_lookup::hashed == lookup)
+                {
+                    inserted.hash = TraitsT::hash(inserted.key);
+                }
+            }
+
+            // stable sorting keeps rows with equal keys in insertion order, which is required for the preference rule
+            if constexpr (detail::table_lookup::hashed == lookup)
+            {
+                std::ranges::stable_sort(m_Rows, std::less{}, &Row::hash);
+            }
+            else if constexpr (detail::table_lookup::sorted == lookup)
+            {
+                std::ranges::stable_sort(m_Rows, std::less{}, &Row::key);
+            }
+        }
+
+        /**
+         * \brief Returns the total number of rows.
+         */
+        [[nodiscard]]
+        constexpr std::size_t size() const noexcept
+        {
+            return m_Rows.size();
+        }
+
+        /**
+         * \copydoc Expectation::report
+         */
+        [[nodiscard]]
+        ExpectationReport report() const override
+        {
+            std::vector<std::optional<StringT>> descriptions{describe_table()};
+            std::apply(
+                [&](const auto&... policies) {
+                    (descriptions.emplace_back(policies.describe()), ...);
+                },
+                m_Policies);
+
+            constexpr std::size_t maxReportedRows{10u};
+            std::size_t unsatisfiedRows{};
+            for (const Row& row : m_Rows
+                                      | std::views::filter([this](const Row& r) noexcept { return !is_satisfied(r); }))
+            {
+                if (++unsatisfiedRows <= maxReportedRows)
+                {
+                    StringT description{"unsatisfied row: "};
+                    mimicpp::print(std::back_inserter(description), row.key);
+                    format::format_to(
+                        std::back_inserter(description),
+                        " (matched {} times)",
+                        row.count);
+                    descriptions.emplace_back(std::move(description));
+                }
+            }
+
+            if (maxReportedRows < unsatisfiedRows)
+            {
+                descriptions.emplace_back(
+                    format::format(
+                        "and {} more unsatisfied row(s)",
+                        unsatisfiedRows - maxReportedRows));
+            }
+
+            return ExpectationReport{
+                .sourceLocation = m_SourceLocation,
+                .finalizerDescription = std::nullopt,
+                .timesDescription = format::format(
+                    "{} out of {} row(s) are satisfied, each row expects between {} and {} match(es)",
+                    m_Rows.size() - unsatisfiedRows,
+                    m_Rows.size(),
+                    m_Min,
+                    m_Max),
+                .expectationDescriptions = std::move(descriptions)};
+        }
+
+        /**
+         * \copydoc Expectation::is_satisfied
+         */
+        [[nodiscard]]
+        bool is_satisfied() const noexcept override
+        {
+            return std::ranges::all_of(
+                       m_Rows,
+                       [this](const Row& row) noexcept { return is_satisfied(row); })
+                && std::apply(
+                       [](const auto&... policies) noexcept {
+                           return (... && policies.is_satisfied());
+                       },
+                       m_Policies);
+        }
+
+        /**
+         * \copydoc Expectation::is_matching
+         */
+        [[nodiscard]]
+        bool is_matching(const CallInfoT& call) const override
+        {
+            return find_row(TraitsT::as_key_ref(call.args)).has_value()
+                && std::apply(
+                       [&](const auto&... policies) {
+                           return (... && policies.matches(call));
+                       },
+                       m_Policies);
+        }
+
+        /**
+         * \copydoc Expectation::matches
+         */
+        [[nodiscard]]
+        MatchReport matches(const CallInfoT& call) const override
+        {
+            const std::optional index = find_row(TraitsT::as_key_ref(call.args));
+
+            return MatchReport{
+                .sourceLocation = m_SourceLocation,
+                .finalizeReport = {std::nullopt},
+                .controlReport = index
+                                   ? make_control_state(m_Rows[*index])
+                                   : control_state_t{state_applicable{.min = m_Min, .max = m_Max}},
+                .expectationReports = std::apply(
+                    [&](const auto&... policies) {
+                        return std::vector<MatchReport::Expectation>{
+                            MatchReport::Expectation{
+                                                     .isMatching = index.has_value(),
+                                                     .description = describe_table()},
+                            MatchReport::Expectation{
+                                                     .isMatching = policies.matches(call),
+                                                     .description = policies.describe()}
+                            ...
+                        };
+                    },
+                    m_Policies)};
+        }
+
+        /**
+         * \copydoc Expectation::consume
+         */
+        void consume(const CallInfoT& call) override
+        {
+            const std::optional index = find_row(TraitsT::as_key_ref(call.args));
+            assert(index && m_Rows[*index].count < m_Max && "Call does not match.");
+
+            ++m_Rows[*index].count;
+            m_Current = *index;
+
+            std::apply(
+                [&](auto&... policies) noexcept {
+                    (..., policies.consume(call));
+                },
+                m_Policies);
+        }
+
+        /**
+         * \copydoc Expectation::finalize_call
+         */
+        [[nodiscard]]
+        constexpr ReturnT finalize_call(const CallInfoT& call) override
+        {
+            assert(m_Current < m_Rows.size() && "No row has been consumed.");
+
+            Value& value = m_Rows[m_Current].value;
+            if constexpr (std::invocable<Value&, const CallInfoT&>)
+            {
+                if constexpr (std::is_void_v<ReturnT>)
+                {
+                    std::invoke(value, call);
+                }
+                else
+                {
+                    return static_cast<ReturnT>(std::invoke(value, call));
+                }
+            }
+            else if constexpr (!std::is_void_v<ReturnT>)
+            {
+                return static_cast<ReturnT>(
+                    static_cast<std::unwrap_reference_t<Value>&>(value));
+            }
+        }
+
+        /**
+         * \copydoc Expectation::from
+         */
+        [[nodiscard]]
+        constexpr const std::source_location& from() const noexcept override
+        {
+            return m_SourceLocation;
+        }
+
+    private:
+        struct Row
+        {
+            std::size_t hash;
+            KeyT key;
+            Value value;
+            int count{};
+        };
+
+        std::source_location m_SourceLocation;
+        int m_Min;
+        int m_Max;
+        std::vector<Row> m_Rows{};
+        std::size_t m_Current{};
+        PolicyListT m_Policies;
+
+        [[nodiscard]]
+        constexpr bool is_satisfied(const Row& row) const noexcept
+        {
+            return m_Min <= row.count
+                && row.count <= m_Max;
+        }
+
+        [[nodiscard]]
+        control_state_t make_control_state(const Row& row) const
+        {
+            if (row.count == m_Max)
+            {
+                return state_saturated{
+                    .min = m_Min,
+                    .max = m_Max,
+                    .count = row.count};
+            }
+
+            return state_applicable{
+                .min = m_Min,
+                .max = m_Max,
+                .count = row.count};
+        }
+
+        [[nodiscard]]
+        StringT describe_table() const
+        {
+            return format::format(
+                "expect: args match one of {} table row(s)",
+                m_Rows.size());
+        }
+
+        [[nodiscard]]
+        std::pair<std::size_t, std::size_t> candidates(const KeyRefT& key) const
+        {
+            if constexpr (detail::table_lookup::hashed == lookup)
+            {
+                const auto [first, last] = std::ranges::equal_range(
+                    m_Rows,
+                    TraitsT::hash(key),
+                    std::less{},
+                    &Row::hash);
+                return {
+                    static_cast<std::size_t>(first - m_Rows.cbegin()),
+                    static_cast<std::size_t>(last - m_Rows.cbegin())};
+            }
+            else if constexpr (detail::table_lookup::sorted == lookup)
+            {
+                struct row_less
+                {
+                    [[nodiscard]]
+                    bool operator()(const Row& row, const KeyRefT& k) const
+                    {
+                        return row.key < k;
+                    }
+
+                    [[nodiscard]]
+                    bool operator()(const KeyRefT& k, const Row& row) const
+                    {
+                        return k < row.key;
+                    }
+                };
+
+                const auto [first, last] = std::equal_range(
+                    m_Rows.cbegin(),
+                    m_Rows.cend(),
+                    key,
+                    row_less{});
+                return {
+                    static_cast<std::size_t>(first - m_Rows.cbegin()),
+                    static_cast<std::size_t>(last - m_Rows.cbegin())};
+            }
+            else
+            {
+                return {0u, m_Rows.size()};
+            }
+        }
+
+        /**
+         * \brief Selects the latest non-saturated row with the given key, or the latest saturated one, if no other option exists.
+         */
+        [[nodiscard]]
+        std::optional<std::size_t> find_row(const KeyRefT& key) const
+        {
+            std::optional<std::size_t> saturated{};
+            for (auto [first, index] = candidates(key);
+                 first < index;)
+            {
+                if (const Row& row = m_Rows[--index];
+                    row.key == key)
+                {
+                    if (row.count < m_Max)
+                    {
+                        return index;
+                    }
+
+                    if (!saturated)
+                    {
+                        saturated = index;
+                    }
+                }
+            }
+
+            return saturated;
+        }
+    };
+
+    /**
+     * \}
+     */
+}
+
+namespace mimicpp::detail
+{
+    template <typename Signature, table_rows_for<Signature> Rows, typename... Policies>
+    [[nodiscard]]
+    ScopedExpectation make_table_expectation(
+        std::shared_ptr<ExpectationCollection<Signature>> collection,
+        Rows&& rows,
+        const TimesConfig& timesConfig,
+        const std::source_location& sourceLocation,
+        Policies... policies)
+    {
+        using ExpectationT = TableExpectation<
+            Signature,
+            table_row_value_t<std::ranges::range_reference_t<Rows>>,
+            Policies...>;
+
+        return ScopedExpectation{
+            std::move(collection),
+            std::make_shared<ExpectationT>(
+                sourceLocation,
+                std::forward<Rows>(rows),
+                timesConfig,
+                std::move(policies)...)};
+    }
+}
+
+#endif
@@ -0,0 +1,71 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MIMICPP_EXPLICIT_INSTANTIATION_HPP
+#define MIMICPP_EXPLICIT_INSTANTIATION_HPP
+
+#pragma once
+
+/**
+ * \defgroup EXPLICIT_INSTANTIATION explicit instantiation
+ * \ingroup MOCK
+ * \brief Macros, which let users instantiate the heavy templates once instead of in each translation-unit.
+ * \details Large test-suites usually mock the same signatures in lots of translation-units, which then all instantiate
+ * and compile the same ``ExpectationCollection`` and printing code over and over again.
+ * The ``MIMICPP_EXTERN_*`` macros declare an explicit instantiation and thus suppress the implicit one. They are
+ * intended to be used in a common header (e.g. the one, which is used as precompiled header).
+ * The matching ``MIMICPP_INSTANTIATE_*`` macros must then be used exactly once in a dedicated source-file of the
+ * executable.
+ * \snippet ExplicitInstantiation.cpp explicit instantiation
+ *
+ * All macros accept types containing commas (e.g. ``std::map<int, int>``) and must be used at global namespace scope.
+ * \note The mimic++ headers must be included before these macros are used.
+ *
+ *\{
+ */
+
+/**
+ * \brief Declares the explicit instantiation of the ``ExpectationCollection`` for the given signature.
+ * \param ... The decayed signature (e.g. ``void(int)`` for mocks of ``void(int) const noexcept``).
+ */
+#define MIMICPP_EXTERN_EXPECTATION_COLLECTION(...) \
+    extern template class ::mimicpp::ExpectationCollection<__VA_ARGS__>
+
+/**
+ * \brief Defines the explicit instantiation of the ``ExpectationCollection`` for the given signature.
+ * \param ... The decayed signature (e.g. ``void(int)`` for mocks of ``void(int) const noexcept``).
+ */
+#define MIMICPP_INSTANTIATE_EXPECTATION_COLLECTION(...) \
+    template class ::mimicpp::ExpectationCollection<__VA_ARGS__>
+
+/**
+ * \brief Declares the explicit instantiation of ``mimicpp::print`` for const lvalues of the given type.
+ * \param ... The type.
+ */
+#define MIMICPP_EXTERN_PRINTER(...)                                                                                  \
+    extern template ::mimicpp::PrintIteratorT                                                                        \
+        mimicpp::detail::PrintFn::operator()<::mimicpp::PrintIteratorT, ::std::type_identity_t<__VA_ARGS__> const&>( \
+            ::mimicpp::PrintIteratorT,                                                                               \
+            ::std::type_identity_t<__VA_ARGS__> const&) const;                                                       \
+    extern template ::mimicpp::StringT                                                                               \
+        mimicpp::detail::PrintFn::operator()<::std::type_identity_t<__VA_ARGS__> const&>(::std::type_identity_t<__VA_ARGS__> const&) const
+
+/**
+ * \brief Defines the explicit instantiation of ``mimicpp::print`` for const lvalues of the given type.
+ * \param ... The type.
+ */
+#define MIMICPP_INSTANTIATE_PRINTER(...)                                                                             \
+    template ::mimicpp::PrintIteratorT                                                                               \
+        mimicpp::detail::PrintFn::operator()<::mimicpp::PrintIteratorT, ::std::type_identity_t<__VA_ARGS__> const&>( \
+            ::mimicpp::PrintIteratorT,                                                                               \
+            ::std::type_identity_t<__VA_ARGS__> const&) const;                                                       \
+    template ::mimicpp::StringT                                                                                      \
+        mimicpp::detail::PrintFn::operator()<::std::type_identity_t<__VA_ARGS__> const&>(::std::type_identity_t<__VA_ARGS__> const&) const
+
+/**
+ * \}
+ */
+
+#endif
@@ -13,6 +13,29 @@
 // ReSharper disable once CppUnusedIncludeDirective
 #include <version>
 
+/**
+ * \brief Specifier for the non-template functions, which are part of the ``mimicpp::compiled`` library.
+ * \details When ``MIMICPP_CONFIG_COMPILED`` is defined, the headers just declare these functions and the definitions
+ * are compiled once into that library. Otherwise, the definitions are provided as ``inline`` functions.
+ */
+#ifdef MIMICPP_CONFIG_COMPILED
+    #define MIMICPP_DETAIL_INLINE
+#else
+    #define MIMICPP_DETAIL_INLINE inline
+#endif
+
+/**
+ * \brief Marks functions, which are just executed on failures, as cold and prevents them from being inlined.
+ * \details This keeps the failure handling out of the (heavily instantiated) hot paths.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+    #define MIMICPP_DETAIL_COLD [[gnu::cold, gnu::noinline]]
+#elif defined(_MSC_VER)
+    #define MIMICPP_DETAIL_COLD __declspec(noinline)
+#else
+    #define MIMICPP_DETAIL_COLD
+#endif
+
 namespace mimicpp::call
 {
     template <typename Return, typename... Args>
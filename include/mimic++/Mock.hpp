@@ -8,19 +8,25 @@
 
 #pragma once
 
+#include "mimic++/CallRecorder.hpp"
 #include "mimic++/Expectation.hpp"
 #include "mimic++/ExpectationBuilder.hpp"
+#include "mimic++/ExpectationTable.hpp"
 #include "mimic++/Fwd.hpp"
+#include "mimic++/Spy.hpp"
 #include "mimic++/Stacktrace.hpp"
 #include "mimic++/TypeTraits.hpp"
 #include "mimic++/Utility.hpp"
 #include "mimic++/policies/GeneralPolicies.hpp"
 
+#include <concepts>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
 namespace mimicpp::detail
 {
-    template <typename Derived, typename Signature>
-    using call_interface_t = typename call_convention_traits<
-        signature_call_convention_t<Signature>>::template call_interface_t<Derived, Signature>;
 
     template <typename Derived, typename Signature, typename... Params>
     class DefaultCallInterface<
@@ -130,6 +136,201 @@ namespace mimicpp::detail
         }
     };
 
+    /**
+     * \brief Receives a by-value parameter without copying it, if possible.
+     * \details Non-const lvalues and rvalues of the exact parameter type are bound directly, thus the mock observes
+     * the caller's object instead of a copy.
+     * Everything else (e.g. const lvalues or arguments, which are just convertible to ``T``) is materialized into
+     * an internal storage, which mirrors the usual by-value behaviour.
+     * \note Instances are bound to the full-expression of the call and are thus neither copyable nor movable.
+     */
+    template <typename T>
+    class ForwardedParam
+    {
+    public:
+        ~ForwardedParam() = default;
+
+        ForwardedParam(const ForwardedParam&) = delete;
+        ForwardedParam& operator=(const ForwardedParam&) = delete;
+        ForwardedParam(ForwardedParam&&) = delete;
+        ForwardedParam& operator=(ForwardedParam&&) = delete;
+
+        [[nodiscard]]
+        constexpr ForwardedParam(T& value) noexcept // NOLINT(*-explicit-constructor)
+            : m_Value{std::addressof(value)}
+        {
+        }
+
+        [[nodiscard]]
+        constexpr ForwardedParam(T&& value) noexcept // NOLINT(*-explicit-constructor)
+            : m_Value{std::addressof(value)}
+        {
+        }
+
+        template <typename Arg>
+            requires(!std::same_as<ForwardedParam, std::remove_cvref_t<Arg>>)
+                 && (!std::same_as<T&, Arg &&>)
+                 && (!std::same_as<T &&, Arg &&>)
+                 && std::convertible_to<Arg, T>
+        [[nodiscard]]
+        constexpr ForwardedParam(Arg&& arg) // NOLINT(*-explicit-constructor)
+            : m_Storage{std::in_place, std::forward<Arg>(arg)},
+              m_Value{std::addressof(*m_Storage)}
+        {
+        }
+
+        [[nodiscard]]
+        constexpr T& get() const noexcept
+        {
+            return *m_Value;
+        }
+
+    private:
+        std::optional<T> m_Storage{};
+        T* m_Value;
+    };
+
+    /**
+     * \brief Determines, how a parameter is received by a forwarding call-interface.
+     * \details References and scalars are received as-is, because there is nothing to gain;
+     * all other object-types are received via ``ForwardedParam``.
+     */
+    template <typename Param>
+    using forwarded_param_t = std::conditional_t<
+        std::is_reference_v<Param> || std::is_scalar_v<Param>,
+        Param,
+        ForwardedParam<Param>>;
+
+    template <typename T>
+    [[nodiscard]]
+    constexpr T& unwrap_forwarded_param(T& param) noexcept
+    {
+        return param;
+    }
+
+    template <typename T>
+    [[nodiscard]]
+    constexpr T& unwrap_forwarded_param(ForwardedParam<T>& param) noexcept
+    {
+        return param.get();
+    }
+
+    template <
+        typename Derived,
+        typename Signature,
+        Constness constQualifier = signature_const_qualification_v<Signature>,
+        ValueCategory refQualifier = signature_ref_qualification_v<Signature>,
+        typename ParamList = signature_param_list_t<Signature>>
+    class ForwardingCallInterface;
+
+    template <typename Derived, typename Signature, typename... Params>
+    class ForwardingCallInterface<
+        Derived,
+        Signature,
+        Constness::non_const,
+        ValueCategory::any,
+        type_list<Params...>>
+    {
+    public:
+        constexpr signature_return_type_t<Signature> operator()(
+            forwarded_param_t<Params>... params,
+            const std::source_location& from = std::source_location::current()) noexcept(signature_is_noexcept_v<Signature>)
+        {
+            return static_cast<const Derived&>(*this)
+                .handle_call(std::tuple{std::ref(unwrap_forwarded_param(params))...}, from);
+        }
+    };
+
+    template <typename Derived, typename Signature, typename... Params>
+    class ForwardingCallInterface<
+        Derived,
+        Signature,
+        Constness::as_const,
+        ValueCategory::any,
+        type_list<Params...>>
+    {
+    public:
+        constexpr signature_return_type_t<Signature> operator()(
+            forwarded_param_t<Params>... params,
+            const std::source_location& from = std::source_location::current()) const noexcept(signature_is_noexcept_v<Signature>)
+        {
+            return static_cast<const Derived&>(*this)
+                .handle_call(std::tuple{std::ref(unwrap_forwarded_param(params))...}, from);
+        }
+    };
+
+    template <typename Derived, typename Signature, typename... Params>
+    class ForwardingCallInterface<
+        Derived,
+        Signature,
+        Constness::non_const,
+        ValueCategory::lvalue,
+        type_list<Params...>>
+    {
+    public:
+        constexpr signature_return_type_t<Signature> operator()(
+            forwarded_param_t<Params>... params,
+            const std::source_location& from = std::source_location::current()) & noexcept(signature_is_noexcept_v<Signature>)
+        {
+            return static_cast<const Derived&>(*this)
+                .handle_call(std::tuple{std::ref(unwrap_forwarded_param(params))...}, from);
+        }
+    };
+
+    template <typename Derived, typename Signature, typename... Params>
+    class ForwardingCallInterface<
+        Derived,
+        Signature,
+        Constness::as_const,
+        ValueCategory::lvalue,
+        type_list<Params...>>
+    {
+    public:
+        constexpr signature_return_type_t<Signature> operator()(
+            forwarded_param_t<Params>... params,
+            const std::source_location& from = std::source_location::current()) const& noexcept(signature_is_noexcept_v<Signature>)
+        {
+            return static_cast<const Derived&>(*this)
+                .handle_call(std::tuple{std::ref(unwrap_forwarded_param(params))...}, from);
+        }
+    };
+
+    template <typename Derived, typename Signature, typename... Params>
+    class ForwardingCallInterface<
+        Derived,
+        Signature,
+        Constness::non_const,
+        ValueCategory::rvalue,
+        type_list<Params...>>
+    {
+    public:
+        constexpr signature_return_type_t<Signature> operator()(
+            forwarded_param_t<Params>... params,
+            const std::source_location& from = std::source_location::current()) && noexcept(signature_is_noexcept_v<Signature>)
+        {
+            return static_cast<const Derived&>(*this)
+                .handle_call(std::tuple{std::ref(unwrap_forwarded_param(params))...}, from);
+        }
+    };
+
+    template <typename Derived, typename Signature, typename... Params>
+    class ForwardingCallInterface<
+        Derived,
+        Signature,
+        Constness::as_const,
+        ValueCategory::rvalue,
+        type_list<Params...>>
+    {
+    public:
+        constexpr signature_return_type_t<Signature> operator()(
+            forwarded_param_t<Params>... params,
+            const std::source_location& from = std::source_location::current()) const&& noexcept(signature_is_noexcept_v<Signature>)
+        {
+            return static_cast<const Derived&>(*this)
+                .handle_call(std::tuple{std::ref(unwrap_forwarded_param(params))...}, from);
+        }
+    };
+
     template <
         typename Derived,
         typename Signature,
@@ -155,6 +356,17 @@ namespace mimicpp::detail
             return static_cast<const Derived&>(*this)
                 .make_expectation_builder(std::forward<Args>(args)...);
         }
+
+        template <table_rows_for<Signature> Rows>
+        [[nodiscard]]
+        ScopedExpectation expect_each(
+            Rows&& rows,
+            TimesConfig timesConfig = {},
+            const std::source_location& loc = std::source_location::current())
+        {
+            return static_cast<const Derived&>(*this)
+                .make_table_expectation(std::forward<Rows>(rows), std::move(timesConfig), loc);
+        }
     };
 
     template <typename Derived, typename Signature, typename... Params>
@@ -174,6 +386,17 @@ namespace mimicpp::detail
             return static_cast<const Derived&>(*this)
                 .make_expectation_builder(std::forward<Args>(args)...);
         }
+
+        template <table_rows_for<Signature> Rows>
+        [[nodiscard]]
+        ScopedExpectation expect_each(
+            Rows&& rows,
+            TimesConfig timesConfig = {},
+            const std::source_location& loc = std::source_location::current()) const
+        {
+            return static_cast<const Derived&>(*this)
+                .make_table_expectation(std::forward<Rows>(rows), std::move(timesConfig), loc);
+        }
     };
 
     template <typename Derived, typename Signature, typename... Params>
@@ -193,6 +416,17 @@ namespace mimicpp::detail
             return static_cast<const Derived&>(*this)
                 .make_expectation_builder(std::forward<Args>(args)...);
         }
+
+        template <table_rows_for<Signature> Rows>
+        [[nodiscard]]
+        ScopedExpectation expect_each(
+            Rows&& rows,
+            TimesConfig timesConfig = {},
+            const std::source_location& loc = std::source_location::current()) &
+        {
+            return static_cast<const Derived&>(*this)
+                .make_table_expectation(std::forward<Rows>(rows), std::move(timesConfig), loc);
+        }
     };
 
     template <typename Derived, typename Signature, typename... Params>
@@ -212,6 +446,17 @@ namespace mimicpp::detail
             return static_cast<const Derived&>(*this)
                 .make_expectation_builder(std::forward<Args>(args)...);
         }
+
+        template <table_rows_for<Signature> Rows>
+        [[nodiscard]]
+        ScopedExpectation expect_each(
+            Rows&& rows,
+            TimesConfig timesConfig = {},
+            const std::source_location& loc = std::source_location::current()) const&
+        {
+            return static_cast<const Derived&>(*this)
+                .make_table_expectation(std::forward<Rows>(rows), std::move(timesConfig), loc);
+        }
     };
 
     template <typename Derived, typename Signature, typename... Params>
@@ -231,6 +476,17 @@ namespace mimicpp::detail
             return static_cast<const Derived&>(*this)
                 .make_expectation_builder(std::forward<Args>(args)...);
         }
+
+        template <table_rows_for<Signature> Rows>
+        [[nodiscard]]
+        ScopedExpectation expect_each(
+            Rows&& rows,
+            TimesConfig timesConfig = {},
+            const std::source_location& loc = std::source_location::current()) &&
+        {
+            return static_cast<const Derived&>(*this)
+                .make_table_expectation(std::forward<Rows>(rows), std::move(timesConfig), loc);
+        }
     };
 
     template <typename Derived, typename Signature, typename... Params>
@@ -250,28 +506,56 @@ namespace mimicpp::detail
             return static_cast<const Derived&>(*this)
                 .make_expectation_builder(std::forward<Args>(args)...);
         }
+
+        template <table_rows_for<Signature> Rows>
+        [[nodiscard]]
+        ScopedExpectation expect_each(
+            Rows&& rows,
+            TimesConfig timesConfig = {},
+            const std::source_location& loc = std::source_location::current()) const&&
+        {
+            return static_cast<const Derived&>(*this)
+                .make_table_expectation(std::forward<Rows>(rows), std::move(timesConfig), loc);
+        }
     };
 
     template <typename Signature>
     using expectation_collection_ptr_for = std::shared_ptr<ExpectationCollection<signature_decay_t<Signature>>>;
 
-    template <typename Signature, typename ParamList = signature_param_list_t<Signature>>
+    template <typename Derived, typename Signature, bool forwardParams>
+    struct call_interface
+    {
+        using type = typename call_convention_traits<
+            signature_call_convention_t<Signature>>::template call_interface_t<Derived, Signature>;
+    };
+
+    template <typename Derived, typename Signature>
+    struct call_interface<Derived, Signature, true>
+    {
+        using type = ForwardingCallInterface<Derived, Signature>;
+    };
+
+    template <typename Derived, typename Signature, bool forwardParams = false>
+    using call_interface_t = typename call_interface<Derived, Signature, forwardParams>::type;
+
+    template <typename Signature, bool forwardParams = false, typename ParamList = signature_param_list_t<Signature>>
     class BasicMock;
 
-    template <typename Signature, typename... Params>
-    class BasicMock<Signature, type_list<Params...>>
+    template <typename Signature, bool forwardParams, typename... Params>
+    class BasicMock<Signature, forwardParams, type_list<Params...>>
         : public MockFrontend<
               // MockFrontend doesn't need to know about the call-convention, thus remove it
-              BasicMock<Signature, type_list<Params...>>,
+              BasicMock<Signature, forwardParams, type_list<Params...>>,
               signature_remove_call_convention_t<Signature>>,
           public call_interface_t<
-              BasicMock<Signature, type_list<Params...>>,
-              Signature>
+              BasicMock<Signature, forwardParams, type_list<Params...>>,
+              Signature,
+              forwardParams>
     {
         using SignatureT = signature_remove_call_convention_t<Signature>;
 
         friend class MockFrontend<BasicMock, SignatureT>;
-        friend call_interface_t<BasicMock, Signature>;
+        friend call_interface_t<BasicMock, Signature, forwardParams>;
 
         static constexpr Constness constQualification = signature_const_qualification_v<SignatureT>;
         static constexpr ValueCategory refQualification = signature_ref_qualification_v<SignatureT>;
@@ -288,6 +572,26 @@ namespace mimicpp::detail
         {
         }
 
+        template <typename Projection>
+        [[nodiscard]]
+        CallRecorder<signature_decay_t<SignatureT>, Projection> make_call_recorder(Projection projection) const
+        {
+            return CallRecorder<signature_decay_t<SignatureT>, Projection>{
+                m_Expectations,
+                std::move(projection)};
+        }
+
+        template <typename Fun>
+        [[nodiscard]]
+        ScopedSpy<signature_decay_t<SignatureT>> make_spy(Fun fun) const
+        {
+            using FallbackT = ForwardingFallback<signature_decay_t<SignatureT>, Fun, forwardParams>;
+
+            return ScopedSpy<signature_decay_t<SignatureT>>{
+                m_Expectations,
+                std::make_shared<FallbackT>(std::move(fun))};
+        }
+
     private:
         ExpectationCollectionPtrT m_Expectations;
         std::size_t m_StacktraceSkip;
@@ -314,6 +618,22 @@ namespace mimicpp::detail
                 && expectation_policies::Category<refQualification>{}
                 && expectation_policies::Constness<constQualification>{};
         }
+
+        template <typename Rows>
+        [[nodiscard]]
+        ScopedExpectation make_table_expectation(
+            Rows&& rows,
+            TimesConfig timesConfig,
+            const std::source_location& loc) const
+        {
+            return detail::make_table_expectation(
+                m_Expectations,
+                std::forward<Rows>(rows),
+                timesConfig,
+                loc,
+                expectation_policies::Category<refQualification>{},
+                expectation_policies::Constness<constQualification>{});
+        }
     };
 
     template <typename List>
@@ -400,6 +720,8 @@ namespace mimicpp
         using detail::BasicMock<FirstSignature>::expect_call;
         using detail::BasicMock<OtherSignatures>::operator()...;
         using detail::BasicMock<OtherSignatures>::expect_call...;
+        using detail::BasicMock<FirstSignature>::expect_each;
+        using detail::BasicMock<OtherSignatures>::expect_each...;
 
         /**
          * \brief Defaulted destructor.
@@ -454,6 +776,40 @@ namespace mimicpp
          */
         Mock& operator=(Mock&&) = default;
 
+        /**
+         * \brief Starts recording all calls of the specified signature.
+         * \tparam Signature The signature, whose calls shall be recorded. Defaults to the first signature.
+         * \tparam Projection The projection type.
+         * \param projection The projection, which is applied on the arguments of each call.
+         * \return The newly created recorder.
+         * \note Signatures, which differ just in their qualification, share the same recording.
+         * \see \ref CALL_RECORDER "call recorder"
+         */
+        template <typename Signature = FirstSignature, typename Projection = detail::copy_args_fn>
+            requires(std::same_as<Signature, FirstSignature> || ... || std::same_as<Signature, OtherSignatures>)
+        [[nodiscard]]
+        CallRecorder<signature_decay_t<Signature>, Projection> record_calls(Projection projection = {}) const
+        {
+            return detail::BasicMock<Signature>::make_call_recorder(std::move(projection));
+        }
+
+        /**
+         * \brief Forwards all calls of the specified signature, which aren't matched by any expectation, to the given function.
+         * \tparam Signature The signature, whose calls shall be forwarded. Defaults to the first signature.
+         * \tparam Fun The function type.
+         * \param fun The function, which receives all (forwarded) arguments of unmatched calls.
+         * \return The spy-guard. The spy is active until the guard is destroyed.
+         * \see \ref SPY "spies"
+         */
+        template <typename Signature = FirstSignature, typename Fun>
+            requires(std::same_as<Signature, FirstSignature> || ... || std::same_as<Signature, OtherSignatures>)
+                 && spy_target_for<std::remove_cvref_t<Fun>, signature_decay_t<Signature>>
+        [[nodiscard]]
+        ScopedSpy<signature_decay_t<Signature>> spy_on(Fun&& fun) const
+        {
+            return detail::BasicMock<Signature>::make_spy(std::forward<Fun>(fun));
+        }
+
     private:
         template <typename... Collections>
         [[nodiscard]]
@@ -472,6 +828,143 @@ namespace mimicpp
         }
     };
 
+    /**
+     * \brief A Mock type, which receives its by-value parameters without copying them (if possible).
+     * \tparam FirstSignature The first signature.
+     * \tparam OtherSignatures Other signatures.
+     * \details This is an opt-in alternative to ``Mock``, which behaves identical in all aspects except the call-interface.
+     * Each by-value parameter of class-type is received in a way, that lets non-const lvalues and rvalues of the exact
+     * parameter type bind directly, so no copy has to be made before the call is handled.
+     * Const lvalues and arguments, which just convert to the parameter type, are still materialized as copies.
+     * This matters, when large objects (like ``std::vector`` with thousands of elements) are passed by value.
+     * \snippet Mock.cpp forwarding mock
+     *
+     * \attention As the mock observes the caller's object instead of a private copy, any side-effects (e.g. moving from or
+     * modifying the argument in an action) are visible to the caller.
+     * \note As the parameters are received via implicit conversions, arguments can no longer be passed as braced-init-lists.
+     * \note Only signatures with the default call-convention are supported.
+     */
+    template <typename FirstSignature, typename... OtherSignatures>
+        requires is_overload_set_v<FirstSignature, OtherSignatures...>
+              && std::same_as<detail::default_call_convention, signature_call_convention_t<FirstSignature>>
+              && (... && std::same_as<detail::default_call_convention, signature_call_convention_t<OtherSignatures>>)
+    class ForwardingMock
+        : public detail::BasicMock<FirstSignature, true>,
+          public detail::BasicMock<OtherSignatures, true>...
+    {
+    public:
+        using detail::BasicMock<FirstSignature, true>::operator();
+        using detail::BasicMock<FirstSignature, true>::expect_call;
+        using detail::BasicMock<OtherSignatures, true>::operator()...;
+        using detail::BasicMock<OtherSignatures, true>::expect_call...;
+        using detail::BasicMock<FirstSignature, true>::expect_each;
+        using detail::BasicMock<OtherSignatures, true>::expect_each...;
+
+        /**
+         * \brief Defaulted destructor.
+         */
+        ~ForwardingMock() = default;
+
+        /**
+         * \brief Default constructor.
+         */
+        [[nodiscard]]
+        ForwardingMock()
+            : ForwardingMock{0u}
+        {
+        }
+
+        /**
+         * \brief Constructor, initializing the base-stacktrace-skip.
+         * \param baseStacktraceSkip The base-stacktrace-skip.
+         * \copydetails Mock::Mock(std::size_t)
+         */
+        [[nodiscard]]
+        explicit ForwardingMock(const std::size_t baseStacktraceSkip)
+            : ForwardingMock{
+                  detail::expectation_collection_factory<
+                      detail::unique_list_t<
+                          signature_decay_t<FirstSignature>,
+                          signature_decay_t<OtherSignatures>...>>::make(),
+                  baseStacktraceSkip}
+        {
+        }
+
+        /**
+         * \brief Deleted copy constructor.
+         */
+        ForwardingMock(const ForwardingMock&) = delete;
+
+        /**
+         * \brief Deleted copy assignment operator.
+         */
+        ForwardingMock& operator=(const ForwardingMock&) = delete;
+
+        /**
+         * \brief Defaulted move constructor.
+         */
+        [[nodiscard]]
+        ForwardingMock(ForwardingMock&&) = default;
+
+        /**
+         * \brief Defaulted move assignment operator.
+         */
+        ForwardingMock& operator=(ForwardingMock&&) = default;
+
+        /**
+         * \brief Starts recording all calls of the specified signature.
+         * \tparam Signature The signature, whose calls shall be recorded. Defaults to the first signature.
+         * \tparam Projection The projection type.
+         * \param projection The projection, which is applied on the arguments of each call.
+         * \return The newly created recorder.
+         * \note Signatures, which differ just in their qualification, share the same recording.
+         * \see \ref CALL_RECORDER "call recorder"
+         */
+        template <typename Signature = FirstSignature, typename Projection = detail::copy_args_fn>
+            requires(std::same_as<Signature, FirstSignature> || ... || std::same_as<Signature, OtherSignatures>)
+        [[nodiscard]]
+        CallRecorder<signature_decay_t<Signature>, Projection> record_calls(Projection projection = {}) const
+        {
+            return detail::BasicMock<Signature, true>::make_call_recorder(std::move(projection));
+        }
+
+        /**
+         * \brief Forwards all calls of the specified signature, which aren't matched by any expectation, to the given function.
+         * \tparam Signature The signature, whose calls shall be forwarded. Defaults to the first signature.
+         * \tparam Fun The function type.
+         * \param fun The function, which receives all (forwarded) arguments of unmatched calls.
+         * \return The spy-guard. The spy is active until the guard is destroyed.
+         * \details As by-value parameters may refer to the caller's objects, they are passed as lvalues to the spy.
+         * Thus, the spy receives copies of them and the caller's objects are never moved from.
+         * \see \ref SPY "spies"
+         */
+        template <typename Signature = FirstSignature, typename Fun>
+            requires(std::same_as<Signature, FirstSignature> || ... || std::same_as<Signature, OtherSignatures>)
+                 && detail::borrowing_spy_target_for<std::remove_cvref_t<Fun>, signature_decay_t<Signature>>
+        [[nodiscard]]
+        ScopedSpy<signature_decay_t<Signature>> spy_on(Fun&& fun) const
+        {
+            return detail::BasicMock<Signature, true>::make_spy(std::forward<Fun>(fun));
+        }
+
+    private:
+        template <typename... Collections>
+        [[nodiscard]]
+        explicit ForwardingMock(
+            std::tuple<Collections...> collections,
+            const std::size_t stacktraceSkip) noexcept
+            : detail::BasicMock<FirstSignature, true>{
+                  std::get<detail::expectation_collection_ptr_for<FirstSignature>>(collections),
+                  stacktraceSkip},
+              // clang-format off
+              detail::BasicMock<OtherSignatures, true>{
+                  std::get<detail::expectation_collection_ptr_for<OtherSignatures>>(collections),
+                  stacktraceSkip}...
+        // clang-format on
+        {
+        }
+    };
+
     /**
      * \}
      */
@@ -13,15 +13,24 @@
 #include "mimic++/TypeTraits.hpp"
 #include "mimic++/Utility.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iterator>
+#include <limits>
+#include <map>
 #include <optional>
 #include <ranges>
 #include <source_location>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <typeindex>
+#include <unordered_map>
 #include <utility>
 
 #ifndef MIMICPP_CONFIG_USE_FMT
@@ -40,6 +49,85 @@ namespace mimicpp
 {
     using StringStreamT = std::basic_ostringstream<CharT, CharTraitsT>;
 
+#ifndef MIMICPP_CONFIG_USE_FMT
+    /**
+     * \brief The growable buffer, which is used by all internal stringifications.
+     * \details Printing into this buffer avoids the overhead of ``std::ostream`` (locale handling, virtual ``streambuf``
+     * calls).
+     * When the ``fmt`` backend is enabled, this is a ``fmt::memory_buffer`` (which is written to without any indirection),
+     * otherwise the resulting string is directly used.
+     * \ingroup STRINGIFICATION
+     */
+    using PrintBufferT = StringT;
+
+    /**
+     * \brief The iterator type, which appends to a ``PrintBufferT``.
+     * \ingroup STRINGIFICATION
+     */
+    using PrintIteratorT = std::back_insert_iterator<PrintBufferT>;
+#else
+    using PrintBufferT = fmt::basic_memory_buffer<CharT>;
+    using PrintIteratorT = fmt::appender;
+#endif
+
+    /**
+     * \brief Limits, which prevent huge objects from generating huge texts.
+     * \ingroup STRINGIFICATION
+     * \details Ranges print at most ``maxElements`` elements, strings at most ``maxStringLength`` characters and
+     * ranges or tuples nested deeper than ``maxDepth`` are entirely elided.
+     * The printers stop iterating as soon as a limit is hit and denote the omitted part like ``{ 1, 2, 3, ... (42 more) }``.
+     */
+    struct PrintLimits
+    {
+        std::size_t maxElements{1024u};
+        std::size_t maxStringLength{4096u};
+        std::size_t maxDepth{16u};
+
+        [[nodiscard]]
+        friend bool operator==(const PrintLimits&, const PrintLimits&) = default;
+    };
+
+    namespace detail
+    {
+        [[nodiscard]]
+        inline StringT to_print_string(PrintBufferT&& buffer)
+        {
+#ifndef MIMICPP_CONFIG_USE_FMT
+            return std::move(buffer);
+#else
+            return StringT{buffer.data(), buffer.size()};
+#endif
+        }
+
+        [[nodiscard]]
+        inline PrintLimits& global_print_limits() noexcept
+        {
+            static PrintLimits limits{};
+            return limits;
+        }
+    }
+
+    /**
+     * \brief Returns the currently installed global print limits.
+     * \ingroup STRINGIFICATION
+     */
+    [[nodiscard]]
+    inline PrintLimits print_limits() noexcept
+    {
+        return detail::global_print_limits();
+    }
+
+    /**
+     * \brief Replaces the global print limits.
+     * \ingroup STRINGIFICATION
+     * \details The limits are applied to all types, which don't have a ``custom::print_limits_for`` specialization.
+     * \note This is not synchronized with any printing; thus, users should install the limits before any mock is in use.
+     */
+    inline void set_print_limits(const PrintLimits limits) noexcept
+    {
+        detail::global_print_limits() = limits;
+    }
+
     template <typename T>
     concept print_iterator = std::output_iterator<T, const CharT&>;
 
@@ -228,65 +316,98 @@ namespace mimicpp::custom
      */
     template <typename>
     class Printer;
+
+    /**
+     * \brief User may add specializations with a ``static constexpr PrintLimits value`` member, which are then used
+     * instead of the global limits, when objects of that type are printed.
+     * \ingroup STRINGIFICATION
+     */
+    template <typename>
+    struct print_limits_for;
 }
 
 namespace mimicpp::detail
 {
-    template <
-        print_iterator OutIter,
-        typename T,
-        printer_for<OutIter, T> Printer = custom::Printer<std::remove_cvref_t<T>>>
-    OutIter print(
-        OutIter out,
-        T&& value,
-        [[maybe_unused]] const priority_tag<4>)
+    /**
+     * \brief Denotes the strategy, which is used to print a specific type.
+     */
+    enum class printer_kind
     {
-        return Printer::print(
-            std::move(out),
-            std::forward<T>(value));
-    }
+        custom,
+        internal,
+        range,
+        formattable,
+        unprintable
+    };
 
-    template <
-        print_iterator OutIter,
-        typename T,
-        printer_for<OutIter, T> Printer = Printer<std::remove_cvref_t<T>>>
-    OutIter print(
-        OutIter out,
-        T&& value,
-        [[maybe_unused]] const priority_tag<3>)
+    template <typename T, typename OutIter>
+    [[nodiscard]]
+    consteval printer_kind select_printer_kind() noexcept
     {
-        return Printer::print(
-            std::move(out),
-            std::forward<T>(value));
+        using RawT = std::remove_cvref_t<T>;
+
+        if constexpr (printer_for<custom::Printer<RawT>, OutIter, T>)
+        {
+            return printer_kind::custom;
+        }
+        else if constexpr (printer_for<Printer<RawT>, OutIter, T>)
+        {
+            return printer_kind::internal;
+        }
+        else if constexpr (std::ranges::forward_range<T>)
+        {
+            return printer_kind::range;
+        }
+        else if constexpr (format::detail::formattable<T, CharT>)
+        {
+            return printer_kind::formattable;
+        }
+        else
+        {
+            return printer_kind::unprintable;
+        }
     }
 
+    /**
+     * \brief Selects the printer for the given (possibly cv-ref qualified) type.
+     * \details The options are checked in the order of their precedence, but just once for each type, as the result is
+     * memoized by the variable template.
+     * This is considerably cheaper for the compiler than resolving an overload-set at each call site.
+     */
+    template <typename T, typename OutIter = PrintIteratorT>
+    inline constexpr printer_kind printer_kind_v = select_printer_kind<T, OutIter>();
+
     template <print_iterator OutIter, std::ranges::forward_range Range>
-    OutIter print(
-        OutIter out,
-        Range&& range,
-        priority_tag<2>);
+    OutIter print_range(OutIter out, Range&& range);
 
-    template <print_iterator OutIter, format::detail::formattable<CharT> T>
-    OutIter print(
-        OutIter out,
-        T&& value,
-        [[maybe_unused]] const priority_tag<1>)
+    /**
+     * \brief Appends the text as it is.
+     * \details This is considerably cheaper than ``format_to``, as no format-string has to be parsed.
+     */
+    template <print_iterator OutIter>
+    constexpr OutIter print_literal(OutIter out, const StringViewT text)
     {
-        return format::format_to(
-            std::move(out),
-            "{}",
-            std::forward<T>(value));
+        return std::ranges::copy(text, std::move(out)).out;
     }
 
-    template <print_iterator OutIter>
-    OutIter print(
-        OutIter out,
-        auto&&,
-        [[maybe_unused]] const priority_tag<0>)
+    /**
+     * \brief Forwards to a non-template printer function, which always prints into a ``PrintIteratorT``.
+     * \details This lets printers keep their actual implementation out of line (see ``MIMICPP_CONFIG_COMPILED``).
+     * Other iterator types are served via an intermediate buffer.
+     */
+    template <print_iterator OutIter, typename T>
+    OutIter print_via(OutIter out, PrintIteratorT (*printer)(PrintIteratorT, const T&), const T& value)
     {
-        return format::format_to(
-            std::move(out),
-            "{{?}}");
+        if constexpr (std::same_as<PrintIteratorT, OutIter>)
+        {
+            return printer(std::move(out), value);
+        }
+        else
+        {
+            PrintBufferT buffer{};
+            printer(PrintIteratorT{buffer}, value);
+            return std::ranges::copy(buffer, std::move(out)).out;
+        }
     }
 
     class PrintFn
@@ -297,57 +418,172 @@ namespace mimicpp::detail
             OutIter out,
             T&& value) const
         {
-            static_assert(
-                requires(const priority_tag<4> tag) {
-                    { print(out, std::forward<T>(value), tag) } -> std::convertible_to<OutIter>;
-                },
-                "The given type is not printable. ");
+            constexpr printer_kind kind = printer_kind_v<T, OutIter>;
 
-            return print(
-                std::move(out),
-                std::forward<T>(value),
-                priority_tag<4>{});
+            if constexpr (printer_kind::custom == kind)
+            {
+                return custom::Printer<std::remove_cvref_t<T>>::print(
+                    std::move(out),
+                    std::forward<T>(value));
+            }
+            else if constexpr (printer_kind::internal == kind)
+            {
+                return Printer<std::remove_cvref_t<T>>::print(
+                    std::move(out),
+                    std::forward<T>(value));
+            }
+            else if constexpr (printer_kind::range == kind)
+            {
+                return print_range(
+                    std::move(out),
+                    std::forward<T>(value));
+            }
+            else if constexpr (printer_kind::formattable == kind)
+            {
+                return format::format_to(
+                    std::move(out),
+                    "{}",
+                    std::forward<T>(value));
+            }
+            else
+            {
+                return print_literal(std::move(out), "{?}");
+            }
         }
 
         template <typename T>
         StringT operator()(T&& value) const
         {
-            StringStreamT stream{};
+            PrintBufferT buffer{};
             std::invoke(
                 *this,
-                std::ostreambuf_iterator{stream},
+                PrintIteratorT{buffer},
                 std::forward<T>(value));
-            return std::move(stream).str();
+            return detail::to_print_string(std::move(buffer));
+        }
+    };
+
+    template <typename T>
+    concept has_custom_print_limits = requires {
+        { custom::print_limits_for<T>::value } -> std::convertible_to<PrintLimits>;
+    };
+
+    template <typename T>
+    [[nodiscard]]
+    PrintLimits print_limits_for() noexcept
+    {
+        if constexpr (has_custom_print_limits<T>)
+        {
+            return custom::print_limits_for<T>::value;
+        }
+        else
+        {
+            return global_print_limits();
+        }
+    }
+
+    /**
+     * \brief Tracks the nesting depth of the currently printed ranges and tuples.
+     * \details The depth is stored per thread, as printing may happen concurrently.
+     */
+    class PrintDepthGuard
+    {
+    public:
+        [[nodiscard]]
+        PrintDepthGuard() noexcept
+        {
+            ++depth();
+        }
+
+        ~PrintDepthGuard() noexcept
+        {
+            --depth();
+        }
+
+        PrintDepthGuard(const PrintDepthGuard&) = delete;
+        PrintDepthGuard& operator=(const PrintDepthGuard&) = delete;
+        PrintDepthGuard(PrintDepthGuard&&) = delete;
+        PrintDepthGuard& operator=(PrintDepthGuard&&) = delete;
+
+        /**
+         * \brief Determines, whether the next nesting level exceeds the given limits.
+         */
+        [[nodiscard]]
+        static bool exceeds(const PrintLimits& limits) noexcept
+        {
+            return limits.maxDepth <= depth();
+        }
+
+    private:
+        [[nodiscard]]
+        static std::size_t& depth() noexcept
+        {
+            thread_local std::size_t depth{0u};
+            return depth;
         }
     };
 
+    /**
+     * \brief Denotes the omitted elements. The count is just printed, if it's known.
+     */
+    template <print_iterator OutIter>
+    OutIter print_omission(OutIter out, const std::optional<std::size_t> remaining)
+    {
+        if (remaining)
+        {
+            return format::format_to(
+                std::move(out),
+                "... ({} more)",
+                *remaining);
+        }
+
+        return print_literal(std::move(out), "...");
+    }
+
     template <print_iterator OutIter, std::ranges::forward_range Range>
-    OutIter print(
+    OutIter print_range(
         OutIter out,
-        Range&& range, // NOLINT(cppcoreguidelines-missing-std-forward)
-        const priority_tag<2>)
+        Range&& range) // NOLINT(cppcoreguidelines-missing-std-forward)
     {
-        out = format::format_to(
-            std::move(out),
-            "{{ ");
+        const PrintLimits limits = print_limits_for<std::remove_cvref_t<Range>>();
+        if (PrintDepthGuard::exceeds(limits))
+        {
+            return print_literal(std::move(out), "{ ... }");
+        }
+
+        const PrintDepthGuard guard{};
+        out = print_literal(std::move(out), "{ ");
         auto iter = std::ranges::begin(range);
-        if (const auto end = std::ranges::end(range);
-            iter != end)
+        const auto end = std::ranges::end(range);
+        std::size_t count{0u};
+        for (; iter != end && count < limits.maxElements; ++iter, ++count)
         {
+            if (0u != count)
+            {
+                out = print_literal(std::move(out), ", ");
+            }
+
             constexpr PrintFn print{};
-            out = print(std::move(out), *iter++);
+            out = print(std::move(out), *iter);
+        }
 
-            for (; iter != end; ++iter)
+        if (iter != end)
+        {
+            std::optional<std::size_t> remaining{};
+            if constexpr (std::ranges::sized_range<Range>)
             {
-                out = print(
-                    format::format_to(std::move(out), ", "),
-                    *iter);
+                remaining = static_cast<std::size_t>(std::ranges::size(range)) - count;
             }
+
+            if (0u != count)
+            {
+                out = print_literal(std::move(out), ", ");
+            }
+
+            out = print_omission(std::move(out), remaining);
         }
 
-        return format::format_to(
-            std::move(out),
-            " }}");
+        return print_literal(std::move(out), " }");
     }
 
     template <>
@@ -367,6 +603,33 @@ namespace mimicpp::detail
         }
     };
 
+    template <typename T>
+    concept plain_integral = std::integral<T>
+                          && !std::same_as<T, bool>
+                          && !is_character_v<T>;
+
+    /**
+     * \brief Prints integers without the format-string machinery, as they are by far the most common arguments.
+     * \details The result is identical to the ``{}`` format.
+     */
+    template <plain_integral T>
+    class Printer<T>
+    {
+    public:
+        template <print_iterator OutIter>
+        static OutIter print(OutIter out, const T value)
+        {
+            // sign + all decimal digits
+            std::array<char, 1u + std::numeric_limits<T>::digits10 + 1u> buffer{};
+            const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+            assert(std::errc{} == result.ec && "Buffer is too small.");
+
+            return print_literal(
+                std::move(out),
+                StringViewT{buffer.data(), result.ptr});
+        }
+    };
+
     template <>
     class Printer<std::nullopt_t>
     {
@@ -391,9 +654,9 @@ namespace mimicpp::detail
 
             if (opt)
             {
-                out = format::format_to(std::move(out), "{{ value: ");
+                out = print_literal(std::move(out), "{ value: ");
                 out = print(std::move(out), *opt);
-                return format::format_to(std::move(out), " }}");
+                return print_literal(std::move(out), " }");
             }
             return print(std::move(out), std::nullopt);
         }
@@ -404,7 +667,7 @@ namespace mimicpp::detail
     {
         if constexpr (0u != index)
         {
-            out = format::format_to(std::move(out), ", ");
+            out = print_literal(std::move(out), ", ");
         }
 
         constexpr PrintFn printer{};
@@ -425,16 +688,38 @@ namespace mimicpp::detail
         template <print_iterator OutIter>
         static OutIter print(OutIter out, const T& tuple)
         {
-            out = format::format_to(std::move(out), "{{ ");
+            const PrintLimits limits = print_limits_for<T>();
+            if (PrintDepthGuard::exceeds(limits))
+            {
+                return print_literal(std::move(out), "{ ... }");
+            }
+
+            const PrintDepthGuard guard{};
+            out = print_literal(std::move(out), "{ ");
 
             std::invoke(
                 [&]<std::size_t... indices>([[maybe_unused]] const std::index_sequence<indices...>) {
-                    (...,
-                     (out = tuple_element_print<indices>(std::move(out), tuple)));
+                    // stops at the first element beyond the limit
+                    // the cast silences the unused-value warning of the empty fold
+                    static_cast<void>(
+                        (...
+                         && (indices < limits.maxElements
+                             && (out = tuple_element_print<indices>(std::move(out), tuple), true))));
                 },
                 std::make_index_sequence<std::tuple_size_v<T>>{});
 
-            return format::format_to(std::move(out), " }}");
+            if (constexpr std::size_t size = std::tuple_size_v<T>;
+                limits.maxElements < size)
+            {
+                if (0u != limits.maxElements)
+                {
+                    out = print_literal(std::move(out), ", ");
+                }
+
+                out = print_omission(std::move(out), size - limits.maxElements);
+            }
+
+            return print_literal(std::move(out), " }");
         }
     };
 
@@ -483,17 +768,28 @@ namespace mimicpp::detail
                     prefix);
             }
 
-            out = format::format_to(std::move(out), "\"");
+            out = print_literal(std::move(out), "\"");
+
+            const PrintLimits limits = print_limits_for<String>();
+            std::size_t omitted{0u};
+            const auto truncate = [&](auto&& view) {
+                const std::size_t length = std::ranges::size(view);
+                const std::size_t printed = std::min(length, limits.maxStringLength);
+                omitted = length - printed;
+
+                return std::ranges::subrange{
+                    std::ranges::begin(view),
+                    std::ranges::next(std::ranges::begin(view), static_cast<std::ptrdiff_t>(printed))};
+            };
 
             // By definition, the string concepts requires the view type to be sized and contiguous.
             // For simplicity, let's always manually convert the view type to an actual std::string_view,
-            // which is formattable for sure.
+            // which can then be appended as it is.
             if constexpr (std::same_as<CharT, string_char_t<String>>)
             {
-                auto view = string_traits<String>::view(str);
-                out = format::format_to(
+                auto view = truncate(string_traits<String>::view(str));
+                out = print_literal(
                     std::move(out),
-                    "{}",
                     StringViewT{
                         std::ranges::data(view),
                         std::ranges::size(view)});
@@ -502,7 +798,7 @@ namespace mimicpp::detail
             else if constexpr (printer_for<custom::Printer<string_char_t<String>>, OutIter, string_char_t<String>>)
             {
                 for (custom::Printer<string_char_t<String>> printer{};
-                     const string_char_t<String>& c : string_traits<String>::view(str))
+                     const string_char_t<String>& c : truncate(string_traits<String>::view(str)))
                 {
                     out = printer.print(std::move(out), c);
                 }
@@ -514,7 +810,7 @@ namespace mimicpp::detail
                     return std::bit_cast<intermediate_t>(c);
                 };
 
-                auto view = string_traits<std::remove_cvref_t<T>>::view(std::forward<T>(str));
+                auto view = truncate(string_traits<std::remove_cvref_t<T>>::view(std::forward<T>(str)));
                 auto iter = std::ranges::begin(view);
                 if (const auto end = std::ranges::end(view);
                     iter != end)
@@ -534,7 +830,173 @@ namespace mimicpp::detail
                 }
             }
 
-            return format::format_to(std::move(out), "\"");
+            out = print_literal(std::move(out), "\"");
+            if (0u != omitted)
+            {
+                out = print_omission(
+                    print_literal(std::move(out), " "),
+                    omitted);
+            }
+
+            return out;
+        }
+    };
+
+    template <typename T>
+    struct print_cache_referee
+    {
+        [[nodiscard]]
+        static constexpr const T& get(const T& obj) noexcept
+        {
+            return obj;
+        }
+    };
+
+    template <typename T>
+    struct print_cache_referee<std::reference_wrapper<T>>
+    {
+        [[nodiscard]]
+        static constexpr const T& get(const std::reference_wrapper<T>& obj) noexcept
+        {
+            return obj.get();
+        }
+    };
+
+    template <typename Range>
+    struct print_cache_referee<std::ranges::ref_view<Range>>
+    {
+        [[nodiscard]]
+        static constexpr const Range& get(const std::ranges::ref_view<Range>& obj) noexcept
+        {
+            return obj.base();
+        }
+    };
+
+    /**
+     * \brief Memoizes the textual representations of objects during the creation of a single report.
+     * \details Objects are identified by their address and type, where references (like ``std::reference_wrapper`` or
+     * ``std::ranges::ref_view``) are identified by the address of their referred object.
+     * Thus, equal objects, which are referenced by multiple matchers, are just printed once.
+     * \attention Addresses may be reused by other objects, while the cache is active (e.g. by temporaries).
+     * Thus, the cache must just be used for objects, which are part of a registered owner (see ``register_owner``).
+     */
+    class PrintCache
+    {
+    public:
+        /**
+         * \brief Registers an object, which is neither modified nor destroyed, while the cache is active.
+         * \details All sub-objects of a registered owner are treated as owned.
+         */
+        template <typename T>
+        void register_owner(const T& owner)
+        {
+            const auto* const begin = reinterpret_cast<const std::byte*>(std::addressof(owner));
+            const std::byte*& end = m_Owners[begin];
+            end = std::max(end, begin + sizeof(T), std::less{});
+        }
+
+        /**
+         * \brief Determines, whether the given object is part of a registered owner.
+         */
+        template <typename T>
+        [[nodiscard]]
+        bool owns(const T& obj) const
+        {
+            const auto* const address = reinterpret_cast<const std::byte*>(std::addressof(obj));
+            auto iter = m_Owners.upper_bound(address);
+            if (iter == m_Owners.cbegin())
+            {
+                return false;
+            }
+
+            --iter;
+            return std::less{}(address, iter->second);
+        }
+
+        template <typename T>
+        [[nodiscard]]
+        const StringT& print(const T& obj)
+        {
+            // The type of the actually printed object is part of the key, as wrappers may be printed differently.
+            const Key key{
+                std::addressof(print_cache_referee<T>::get(obj)),
+                typeid(T)};
+
+            auto iter = m_Entries.find(key);
+            if (iter == m_Entries.cend())
+            {
+                constexpr PrintFn print{};
+                iter = m_Entries.emplace(key, print(obj)).first;
+            }
+
+            return iter->second;
+        }
+
+    private:
+        using Key = std::pair<const void*, std::type_index>;
+
+        struct KeyHash
+        {
+            [[nodiscard]]
+            std::size_t operator()(const Key& key) const noexcept
+            {
+                return std::hash<const void*>{}(key.first)
+                     ^ key.second.hash_code();
+            }
+        };
+
+        std::map<const std::byte*, const std::byte*, std::less<>> m_Owners{};
+        std::unordered_map<Key, StringT, KeyHash> m_Entries{};
+    };
+
+    /**
+     * \brief Activates a ``PrintCache`` on the current thread for its whole lifetime.
+     * \details Nested scopes share the cache of the outermost scope.
+     */
+    class PrintCacheScope
+    {
+    public:
+        ~PrintCacheScope() noexcept
+        {
+            if (m_IsOwner)
+            {
+                active() = nullptr;
+            }
+        }
+
+        [[nodiscard]]
+        PrintCacheScope() noexcept
+            : m_IsOwner{!active()}
+        {
+            if (m_IsOwner)
+            {
+                active() = &m_Cache;
+            }
+        }
+
+        PrintCacheScope(const PrintCacheScope&) = delete;
+        PrintCacheScope& operator=(const PrintCacheScope&) = delete;
+        PrintCacheScope(PrintCacheScope&&) = delete;
+        PrintCacheScope& operator=(PrintCacheScope&&) = delete;
+
+        /**
+         * \brief Returns the currently active cache or ``nullptr``, if none is active.
+         */
+        [[nodiscard]]
+        static PrintCache* current() noexcept
+        {
+            return active();
+        }
+
+    private:
+        bool m_IsOwner;
+        PrintCache m_Cache{};
+
+        [[nodiscard]]
+        static PrintCache*& active() noexcept
+        {
+            thread_local PrintCache* cache{nullptr};
+            return cache;
         }
     };
 }
@@ -581,6 +1043,15 @@ namespace mimicpp
      * For example, the string ``u8"Hello, World!"`` will then be printed as
      * ``u8"0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x2c, 0x20, 0x57, 0x6f, 0x72, 0x6c, 0x64, 0x21"``.
      *
+     * ## Print limits
+     *
+     * Mocks may receive huge objects (e.g. buffers with millions of elements), which would generate equally huge reports.
+     * Thus, the internal range, string and tuple printers honor the ``PrintLimits``, which restrict the number of printed
+     * elements, characters and the nesting depth.
+     * The omitted part is denoted like ``{ 1, 2, 3, ... (999997 more) }``.
+     * The global limits can be replaced via ``set_print_limits``, while individual types may specialize
+     * ``mimicpp::custom::print_limits_for`` to use different limits.
+     *
      *\{
      */
 
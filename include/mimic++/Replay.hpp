@@ -0,0 +1,656 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MIMICPP_REPLAY_HPP
+#define MIMICPP_REPLAY_HPP
+
+#pragma once
+
+#include "mimic++/Call.hpp"
+#include "mimic++/ExpectationTable.hpp"
+#include "mimic++/Fwd.hpp"
+#include "mimic++/TypeTraits.hpp"
+#include "mimic++/policies/FinalizerPolicies.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace mimicpp::custom
+{
+    /**
+     * \brief User may add specializations, which will then be used to (de-)serialize values for call-tapes.
+     * \ingroup REPLAY
+     * \details Specializations must provide the following static member functions:
+     * ```cpp
+     * static void write(std::ostream& out, const T& value);
+     * static T read(std::istream& in);
+     * ```
+     * Both are expected to throw, when they fail.
+     */
+    template <typename>
+    struct Serializer;
+}
+
+namespace mimicpp::detail
+{
+    inline void write_bytes(std::ostream& out, const void* const data, const std::size_t count)
+    {
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(count));
+        if (!out)
+        {
+            throw std::runtime_error{"Failed writing to call-tape."};
+        }
+    }
+
+    inline void read_bytes(std::istream& in, void* const data, const std::size_t count)
+    {
+        in.read(static_cast<char*>(data), static_cast<std::streamsize>(count));
+        if (!in)
+        {
+            throw std::runtime_error{"Unexpected end of call-tape."};
+        }
+    }
+
+    template <typename T>
+    struct serializer;
+
+    template <typename T>
+    concept custom_serializable = requires(std::ostream& out, std::istream& in, const T& value) {
+        custom::Serializer<T>::write(out, value);
+        { custom::Serializer<T>::read(in) } -> std::convertible_to<T>;
+    };
+
+    template <typename T>
+    concept builtin_serializable = requires(std::ostream& out, std::istream& in, const T& value) {
+        serializer<T>::write(out, value);
+        { serializer<T>::read(in) } -> std::convertible_to<T>;
+    };
+
+    template <typename T>
+    using serializer_t = std::conditional_t<
+        custom_serializable<T>,
+        custom::Serializer<T>,
+        serializer<T>>;
+
+    template <typename T>
+    concept serializable = custom_serializable<T> || builtin_serializable<T>;
+
+    template <serializable T>
+    void serialize(std::ostream& out, const T& value)
+    {
+        serializer_t<T>::write(out, value);
+    }
+
+    template <serializable T>
+    [[nodiscard]]
+    T deserialize(std::istream& in)
+    {
+        return serializer_t<T>::read(in);
+    }
+
+    inline void serialize_size(std::ostream& out, const std::size_t size)
+    {
+        const auto value = static_cast<std::uint64_t>(size);
+        write_bytes(out, &value, sizeof(value));
+    }
+
+    [[nodiscard]]
+    inline std::size_t deserialize_size(std::istream& in)
+    {
+        std::uint64_t value{};
+        read_bytes(in, &value, sizeof(value));
+        return static_cast<std::size_t>(value);
+    }
+
+    /**
+     * \brief The maximal amount of elements, which are allocated in advance, while a container is read.
+     * \details Sizes are read from the tape and may thus be arbitrary, if the tape is corrupt.
+     * Containers are therefore allocated chunk-wise, so that reading fails at the end of the stream, before any
+     * excessive allocation has been requested.
+     */
+    inline constexpr std::size_t untrustedSizeChunk{4096u};
+
+    /**
+     * \brief The maximal size, which is accepted for containers, whose elements may be serialized to zero bytes.
+     * \details Such sizes aren't backed by any data on the tape, thus reading a corrupt size would never fail otherwise.
+     */
+    inline constexpr std::size_t maxUnbackedSize{std::size_t{1u} << 20u};
+
+    template <serializable T>
+    [[nodiscard]]
+    consteval std::size_t min_serialized_size() noexcept
+    {
+        // the amount of bytes, which custom serializers produce, is unknown
+        if constexpr (custom_serializable<T>)
+        {
+            return 0u;
+        }
+        else
+        {
+            return serializer<T>::minSize;
+        }
+    }
+
+    [[nodiscard]]
+    inline std::optional<std::size_t> remaining_bytes(std::istream& in)
+    {
+        const std::istream::pos_type current = in.tellg();
+        if (std::istream::pos_type{-1} == current)
+        {
+            return std::nullopt;
+        }
+
+        in.seekg(0, std::ios::end);
+        const std::istream::pos_type end = in.tellg();
+        in.clear();
+        in.seekg(current);
+        if (!in || std::istream::pos_type{-1} == end)
+        {
+            throw std::runtime_error{"Failed seeking within call-tape."};
+        }
+
+        return static_cast<std::size_t>(end - current);
+    }
+
+    /**
+     * \brief Reads a container size and rejects it, when it can't be backed by the remaining data.
+     * \param in The source stream.
+     * \param minElementSize The minimal amount of bytes, each element occupies on the tape.
+     * \details The remaining data can only be determined for seekable streams; otherwise reading simply fails at the
+     * end of the stream.
+     */
+    [[nodiscard]]
+    inline std::size_t deserialize_untrusted_size(std::istream& in, const std::size_t minElementSize)
+    {
+        const std::size_t size = deserialize_size(in);
+        if (0u == minElementSize)
+        {
+            if (maxUnbackedSize < size)
+            {
+                throw std::runtime_error{"Call-tape contains an invalid size."};
+            }
+        }
+        else if (const std::optional<std::size_t> remaining = remaining_bytes(in);
+                 remaining
+                 && *remaining / minElementSize < size)
+        {
+            throw std::runtime_error{"Call-tape contains an invalid size."};
+        }
+
+        return size;
+    }
+
+    template <typename T>
+        requires(std::is_arithmetic_v<T> && !std::same_as<T, bool>)
+             || std::is_enum_v<T>
+    struct serializer<T>
+    {
+        static constexpr std::size_t minSize{sizeof(T)};
+
+        static void write(std::ostream& out, const T& value)
+        {
+            write_bytes(out, std::addressof(value), sizeof(T));
+        }
+
+        [[nodiscard]]
+        static T read(std::istream& in)
+        {
+            T value{};
+            read_bytes(in, std::addressof(value), sizeof(T));
+            return value;
+        }
+    };
+
+    // bools are read as integers, as copying any other byte than 0 or 1 into a bool is undefined behaviour
+    template <>
+    struct serializer<bool>
+    {
+        static constexpr std::size_t minSize{sizeof(std::uint8_t)};
+
+        static void write(std::ostream& out, const bool value)
+        {
+            const std::uint8_t byte = value ? 1u : 0u;
+            write_bytes(out, &byte, sizeof(byte));
+        }
+
+        [[nodiscard]]
+        static bool read(std::istream& in)
+        {
+            std::uint8_t byte{};
+            read_bytes(in, &byte, sizeof(byte));
+            if (1u < byte)
+            {
+                throw std::runtime_error{"Call-tape contains an invalid bool."};
+            }
+
+            return 1u == byte;
+        }
+    };
+
+    template <>
+    struct serializer<std::monostate>
+    {
+        static constexpr std::size_t minSize{0u};
+
+        static void write([[maybe_unused]] std::ostream& out, [[maybe_unused]] const std::monostate& value) noexcept
+        {
+        }
+
+        [[nodiscard]]
+        static std::monostate read([[maybe_unused]] std::istream& in) noexcept
+        {
+            return {};
+        }
+    };
+
+    template <typename Char, typename Traits, typename Allocator>
+        requires std::is_trivially_copyable_v<Char>
+    struct serializer<std::basic_string<Char, Traits, Allocator>>
+    {
+        using StringT = std::basic_string<Char, Traits, Allocator>;
+
+        static constexpr std::size_t minSize{sizeof(std::uint64_t)};
+
+        static void write(std::ostream& out, const StringT& value)
+        {
+            serialize_size(out, value.size());
+            write_bytes(out, value.data(), value.size() * sizeof(Char));
+        }
+
+        [[nodiscard]]
+        static StringT read(std::istream& in)
+        {
+            const std::size_t size = deserialize_untrusted_size(in, sizeof(Char));
+            StringT value{};
+            while (value.size() < size)
+            {
+                const std::size_t offset = value.size();
+                value.resize(offset + std::min(size - offset, untrustedSizeChunk));
+                read_bytes(in, value.data() + offset, (value.size() - offset) * sizeof(Char));
+            }
+
+            return value;
+        }
+    };
+
+    template <serializable T, typename Allocator>
+    struct serializer<std::vector<T, Allocator>>
+    {
+        using VectorT = std::vector<T, Allocator>;
+
+        static constexpr std::size_t minSize{sizeof(std::uint64_t)};
+
+        static void write(std::ostream& out, const VectorT& value)
+        {
+            serialize_size(out, value.size());
+            for (const T& element : value)
+            {
+                detail::serialize(out, element);
+            }
+        }
+
+        [[nodiscard]]
+        static VectorT read(std::istream& in)
+        {
+            const std::size_t size = deserialize_untrusted_size(in, min_serialized_size<T>());
+            VectorT value{};
+            value.reserve(std::min(size, untrustedSizeChunk));
+            for (std::size_t i{}; i < size; ++i)
+            {
+                value.emplace_back(detail::deserialize<T>(in));
+            }
+
+            return value;
+        }
+    };
+
+    template <serializable T>
+    struct serializer<std::optional<T>>
+    {
+        static constexpr std::size_t minSize{min_serialized_size<bool>()};
+
+        static void write(std::ostream& out, const std::optional<T>& value)
+        {
+            detail::serialize(out, value.has_value());
+            if (value)
+            {
+                detail::serialize(out, *value);
+            }
+        }
+
+        [[nodiscard]]
+        static std::optional<T> read(std::istream& in)
+        {
+            if (detail::deserialize<bool>(in))
+            {
+                return detail::deserialize<T>(in);
+            }
+
+            return std::nullopt;
+        }
+    };
+
+    template <serializable First, serializable Second>
+    struct serializer<std::pair<First, Second>>
+    {
+        static constexpr std::size_t minSize{min_serialized_size<First>() + min_serialized_size<Second>()};
+
+        static void write(std::ostream& out, const std::pair<First, Second>& value)
+        {
+            detail::serialize(out, value.first);
+            detail::serialize(out, value.second);
+        }
+
+        [[nodiscard]]
+        static std::pair<First, Second> read(std::istream& in)
+        {
+            // the evaluation order of function args is unspecified
+            First first = detail::deserialize<First>(in);
+            return {std::move(first), detail::deserialize<Second>(in)};
+        }
+    };
+
+    template <serializable... Elements>
+    struct serializer<std::tuple<Elements...>>
+    {
+        static constexpr std::size_t minSize{(0u + ... + min_serialized_size<Elements>())};
+
+        static void write(std::ostream& out, const std::tuple<Elements...>& value)
+        {
+            std::apply(
+                [&](const auto&... elements) { (..., detail::serialize(out, elements)); },
+                value);
+        }
+
+        [[nodiscard]]
+        static std::tuple<Elements...> read(std::istream& in)
+        {
+            // braced-init-lists guarantee the left-to-right evaluation
+            return std::tuple<Elements...>{detail::deserialize<Elements>(in)...};
+        }
+    };
+
+    inline constexpr std::array<char, 8u> callTapeMagic{'M', 'I', 'M', 'I', 'C', 'T', 'A', 'P'};
+    inline constexpr std::uint32_t callTapeVersion{1u};
+}
+
+namespace mimicpp
+{
+    /**
+     * \defgroup REPLAY record and replay
+     * \ingroup MOCK
+     * \brief Records the interaction with a real implementation and replays it later on.
+     * \details Slow or non-deterministic dependencies (like a database process) are often a burden for integration tests.
+     * In record mode, a mock forwards all calls to the real implementation and stores each argument- and return-value pair
+     * onto a ``CallTape``, which can then be saved into a binary file.
+     * \snippet Replay.cpp record
+     *
+     * In replay mode, the tape is loaded from that file and fed into an \ref EXPECTATION_TABLE "expectation table",
+     * which answers each call via a pre-indexed lookup.
+     * \snippet Replay.cpp replay
+     *
+     * Arithmetic types, enums, ``std::basic_string``, ``std::vector``, ``std::optional``, ``std::pair`` and ``std::tuple``
+     * are supported out of the box.
+     * Users may add support for their own types by specializing ``custom::Serializer``.
+     *
+     * \note The file format isn't portable across platforms with different endianness or type sizes.
+     *
+     * \{
+     */
+
+    /**
+     * \brief Determines, whether the given signature can be recorded and replayed.
+     * \details All parameters and the return type (if not ``void``) must be serializable after removing any qualifications.
+     */
+    template <typename Signature>
+    concept replayable_signature =
+        std::same_as<Signature, signature_decay_t<Signature>>
+        && detail::serializable<typename detail::table_traits_for<Signature>::key_t>
+        && (std::is_void_v<signature_return_type_t<Signature>>
+            || detail::serializable<std::remove_cvref_t<signature_return_type_t<Signature>>>);
+
+    /**
+     * \brief Stores recorded argument- and return-value pairs of a specific signature.
+     * \tparam Signature The decayed signature.
+     */
+    template <replayable_signature Signature>
+    class CallTape
+    {
+    public:
+        /**
+         * \brief The stored arguments type.
+         */
+        using ArgsT = typename detail::table_traits_for<Signature>::key_t;
+
+        /**
+         * \brief The stored return type. ``std::monostate`` for signatures returning ``void``.
+         */
+        using ResultT = std::conditional_t<
+            std::is_void_v<signature_return_type_t<Signature>>,
+            std::monostate,
+            std::remove_cvref_t<signature_return_type_t<Signature>>>;
+
+        /**
+         * \brief The row type.
+         */
+        using RowT = std::pair<ArgsT, ResultT>;
+
+        /**
+         * \brief Appends a new row.
+         * \param args The arguments.
+         * \param result The returned value.
+         */
+        void record(ArgsT args, ResultT result)
+        {
+            m_Rows.emplace_back(std::move(args), std::move(result));
+        }
+
+        /**
+         * \brief Returns the amount of recorded rows.
+         */
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return m_Rows.size();
+        }
+
+        /**
+         * \brief Returns, whether no rows have been recorded.
+         */
+        [[nodiscard]]
+        bool empty() const noexcept
+        {
+            return m_Rows.empty();
+        }
+
+        /**
+         * \brief Returns all rows in order of recording.
+         */
+        [[nodiscard]]
+        const std::vector<RowT>& rows() const noexcept
+        {
+            return m_Rows;
+        }
+
+        /**
+         * \brief Returns all rows, ready to be used with ``expect_each``.
+         * \details Expectation tables prefer the latest matching row, thus the rows are reversed.
+         * This makes sure, that calls with equal args are answered in the same order as they have been recorded.
+         * \note The returned view refers to the tape, but ``expect_each`` copies all rows.
+         */
+        [[nodiscard]]
+        auto replay_rows() const noexcept
+        {
+            return m_Rows | std::views::reverse;
+        }
+
+        /**
+         * \brief Writes all rows into the given stream.
+         * \param out The destination stream (should be opened in binary mode).
+         * \throws std::runtime_error When writing fails.
+         */
+        void write(std::ostream& out) const
+        {
+            detail::write_bytes(out, detail::callTapeMagic.data(), detail::callTapeMagic.size());
+            detail::serialize(out, detail::callTapeVersion);
+            detail::serialize_size(out, std::tuple_size_v<ArgsT>);
+            detail::serialize_size(out, m_Rows.size());
+            for (const auto& [args, result] : m_Rows)
+            {
+                detail::serialize(out, args);
+                detail::serialize(out, result);
+            }
+        }
+
+        /**
+         * \brief Reads a tape from the given stream.
+         * \param in The source stream (should be opened in binary mode).
+         * \return The read tape.
+         * \throws std::runtime_error When the data is malformed.
+         * \note Rows, which may be serialized to zero bytes (e.g. of ``CallTape<void()>``), can't be validated against
+         * the remaining data. Such tapes are therefore limited to ``2^20`` rows.
+         */
+        [[nodiscard]]
+        static CallTape read(std::istream& in)
+        {
+            std::array<char, detail::callTapeMagic.size()> magic{};
+            detail::read_bytes(in, magic.data(), magic.size());
+            if (magic != detail::callTapeMagic)
+            {
+                throw std::runtime_error{"Not a call-tape."};
+            }
+
+            if (detail::callTapeVersion != detail::deserialize<std::uint32_t>(in))
+            {
+                throw std::runtime_error{"Unsupported call-tape version."};
+            }
+
+            if (std::tuple_size_v<ArgsT> != detail::deserialize_size(in))
+            {
+                throw std::runtime_error{"Call-tape doesn't match the signature."};
+            }
+
+            CallTape tape{};
+            const std::size_t count = detail::deserialize_untrusted_size(
+                in,
+                detail::min_serialized_size<ArgsT>() + detail::min_serialized_size<ResultT>());
+            tape.m_Rows.reserve(std::min(count, detail::untrustedSizeChunk));
+            for (std::size_t i{}; i < count; ++i)
+            {
+                ArgsT args = detail::deserialize<ArgsT>(in);
+                tape.m_Rows.emplace_back(std::move(args), detail::deserialize<ResultT>(in));
+            }
+
+            return tape;
+        }
+
+        /**
+         * \brief Saves the tape to the given file.
+         * \param path The file path.
+         * \throws std::runtime_error When the file can not be written.
+         */
+        void save(const std::filesystem::path& path) const
+        {
+            std::ofstream out{path, std::ios::binary | std::ios::trunc};
+            if (!out)
+            {
+                throw std::runtime_error{"Unable to open call-tape for writing."};
+            }
+
+            write(out);
+        }
+
+        /**
+         * \brief Loads a tape from the given file.
+         * \param path The file path.
+         * \return The loaded tape.
+         * \throws std::runtime_error When the file can not be read or is malformed.
+         */
+        [[nodiscard]]
+        static CallTape load(const std::filesystem::path& path)
+        {
+            std::ifstream in{path, std::ios::binary};
+            if (!in)
+            {
+                throw std::runtime_error{"Unable to open call-tape for reading."};
+            }
+
+            return read(in);
+        }
+
+    private:
+        std::vector<RowT> m_Rows{};
+    };
+
+    /**
+     * \}
+     */
+}
+
+namespace mimicpp::finally
+{
+    /**
+     * \brief During the finalization step, the call is forwarded to the given function and recorded on the tape.
+     * \ingroup REPLAY
+     * \tparam Signature The decayed signature of the tape.
+     * \tparam Fun The function type.
+     * \param tape The destination tape.
+     * \param fun The function, which receives all call arguments as lvalue-references.
+     * \return Returns the invocation result of ``fun``.
+     * \details The arguments are copied before ``fun`` is invoked, thus any modification made by ``fun`` isn't recorded.
+     * Exceptions thrown by ``fun`` are propagated and the call isn't recorded.
+     * \attention The tape must outlive the expectation.
+     */
+    template <typename Signature, typename Fun>
+    [[nodiscard]]
+    constexpr auto record_to(CallTape<Signature>& tape, Fun&& fun)
+    {
+        using TapeT = CallTape<Signature>;
+        using ReturnT = signature_return_type_t<Signature>;
+
+        return expectation_policies::ReturnsResultOf{
+            [&tape, fn = std::forward<Fun>(fun)](const call::info_for_signature_t<Signature>& call) mutable -> ReturnT {
+                typename TapeT::ArgsT args = std::apply(
+                    [](const auto&... refs) { return typename TapeT::ArgsT{std::as_const(refs.get())...}; },
+                    call.args);
+                const auto invoke = [&] {
+                    return std::apply(
+                        [&](const auto&... refs) -> ReturnT { return std::invoke(fn, refs.get()...); },
+                        call.args);
+                };
+
+                if constexpr (std::is_void_v<ReturnT>)
+                {
+                    invoke();
+                    tape.record(std::move(args), {});
+                }
+                else
+                {
+                    ReturnT result = invoke();
+                    tape.record(std::move(args), typename TapeT::ResultT{result});
+                    return std::forward<ReturnT>(result);
+                }
+            }};
+    }
+}
+
+#endif
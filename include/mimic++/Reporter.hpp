@@ -204,141 +204,22 @@ namespace mimicpp
         }
 
         [[nodiscard]]
-        inline StringT stringify_no_match_report(const CallReport& call, const std::span<const MatchReport> matchReports)
-        {
-            StringStreamT ss{};
-            ss << "No match for ";
-            mimicpp::print(
-                std::ostreambuf_iterator{ss},
-                call);
-            ss << "\n";
-
-            if (std::ranges::empty(matchReports))
-            {
-                ss << "No expectations available.\n";
-            }
-            else
-            {
-                format::format_to(
-                    std::ostreambuf_iterator{ss},
-                    "{} available expectation(s):\n",
-                    std::ranges::size(matchReports));
-
-                for (const auto& report : matchReports)
-                {
-                    mimicpp::print(
-                        std::ostreambuf_iterator{ss},
-                        report);
-                    ss << "\n";
-                }
-            }
-
-            stringify_stacktrace(
-                std::ostreambuf_iterator{ss},
-                call.stacktrace);
-
-            return std::move(ss).str();
-        }
+        MIMICPP_DETAIL_INLINE StringT stringify_no_match_report(const CallReport& call, const std::span<const MatchReport> matchReports);
 
         [[nodiscard]]
-        inline StringT stringify_inapplicable_match_report(const CallReport& call, const std::span<const MatchReport> matchReports)
-        {
-            StringStreamT ss{};
-            ss << "No applicable match for ";
-            mimicpp::print(
-                std::ostreambuf_iterator{ss},
-                call);
-            ss << "\n";
-
-            ss << "Tested expectations:\n";
-            for (const auto& report : matchReports)
-            {
-                mimicpp::print(
-                    std::ostreambuf_iterator{ss},
-                    report);
-                ss << "\n";
-            }
-
-            stringify_stacktrace(
-                std::ostreambuf_iterator{ss},
-                call.stacktrace);
-
-            return std::move(ss).str();
-        }
+        MIMICPP_DETAIL_INLINE StringT stringify_inapplicable_match_report(const CallReport& call, const std::span<const MatchReport> matchReports);
 
         [[nodiscard]]
-        inline StringT stringify_report(const CallReport& call, const MatchReport& matchReport)
-        {
-            StringStreamT ss{};
-            ss << "Found match for ";
-            mimicpp::print(
-                std::ostreambuf_iterator{ss},
-                call);
-            ss << "\n";
-
-            mimicpp::print(
-                std::ostreambuf_iterator{ss},
-                matchReport);
-            ss << "\n";
-
-            stringify_stacktrace(
-                std::ostreambuf_iterator{ss},
-                call.stacktrace);
-
-            return std::move(ss).str();
-        }
+        MIMICPP_DETAIL_INLINE StringT stringify_report(const CallReport& call, const MatchReport& matchReport);
 
         [[nodiscard]]
-        inline StringT stringify_unfulfilled_expectation(const ExpectationReport& expectationReport)
-        {
-            StringStreamT ss{};
-            ss << "Unfulfilled expectation:\n";
-            mimicpp::print(
-                std::ostreambuf_iterator{ss},
-                expectationReport);
-            ss << "\n";
-
-            return std::move(ss).str();
-        }
+        MIMICPP_DETAIL_INLINE StringT stringify_unfulfilled_expectation(const ExpectationReport& expectationReport);
 
         [[nodiscard]]
-        inline StringT stringify_unhandled_exception(
+        MIMICPP_DETAIL_INLINE StringT stringify_unhandled_exception(
             const CallReport& call,
             const ExpectationReport& expectationReport,
-            const std::exception_ptr& exception)
-        {
-            StringStreamT ss{};
-            ss << "Unhandled exception: ";
-
-            try
-            {
-                std::rethrow_exception(exception);
-            }
-            catch (const std::exception& e)
-            {
-                ss << "what: "
-                   << e.what()
-                   << "\n";
-            }
-            catch (...)
-            {
-                ss << "Unknown exception type.\n";
-            }
-
-            ss << "while checking expectation:\n";
-            mimicpp::print(
-                std::ostreambuf_iterator{ss},
-                expectationReport);
-            ss << "\n";
-
-            ss << "For ";
-            mimicpp::print(
-                std::ostreambuf_iterator{ss},
-                call);
-            ss << "\n";
-
-            return std::move(ss).str();
-        }
+            const std::exception_ptr& exception);
     }
 
     /**
@@ -441,123 +322,365 @@ namespace mimicpp
         [[noreturn]]
         void report_no_matches(
             CallReport call,
-            std::vector<MatchReport> matchReports) override
-        {
-            assert(
-                std::ranges::all_of(
-                    matchReports,
-                    std::bind_front(std::equal_to{}, MatchResult::none),
-                    &evaluate_match_report));
+            std::vector<MatchReport> matchReports) override;
 
-            const auto msg = detail::stringify_no_match_report(call, matchReports);
-            if (m_Out)
+        [[noreturn]]
+        void report_inapplicable_matches(
+            CallReport call,
+            std::vector<MatchReport> matchReports) override;
+
+        void report_full_match(
+            const CallReport call,
+            const MatchReport matchReport) noexcept override;
+
+        void report_unfulfilled_expectation(
+            ExpectationReport expectationReport) override;
+
+        void report_error(const StringT message) override;
+
+        void report_unhandled_exception(
+            const CallReport call,
+            const ExpectationReport expectationReport,
+            const std::exception_ptr exception) override;
+
+    private:
+        std::ostream* m_Out;
+    };
+
+    /**
+     * \}
+     */
+}
+
+namespace mimicpp::detail
+{
+    [[nodiscard]]
+    MIMICPP_DETAIL_INLINE std::unique_ptr<IReporter>& get_reporter() noexcept;
+
+    [[noreturn]]
+    MIMICPP_DETAIL_INLINE void report_no_matches(
+        CallReport callReport,
+        std::vector<MatchReport> matchReports);
+
+    [[noreturn]]
+    MIMICPP_DETAIL_INLINE void report_inapplicable_matches(
+        CallReport callReport,
+        std::vector<MatchReport> matchReports);
+
+    /**
+     * \brief Reports a call, which isn't fully matched by any expectation.
+     * \details Emits an "inapplicable matches"-report, if any of the collected reports denotes an inapplicable match,
+     * and a "no matches"-report otherwise.
+     * This is the failure path of each ``ExpectationCollection``, which is thus kept out of the heavily instantiated
+     * ``handle_call``.
+     */
+    [[noreturn]]
+    MIMICPP_DETAIL_INLINE void report_unmatched_call(
+        CallReport callReport,
+        std::vector<MatchReport> noMatchReports,
+        std::vector<MatchReport> inapplicableMatchReports);
+
+    MIMICPP_DETAIL_INLINE void report_full_match(
+        CallReport callReport,
+        MatchReport matchReport) noexcept;
+
+    MIMICPP_DETAIL_INLINE void report_unfulfilled_expectation(
+        ExpectationReport expectationReport);
+
+    MIMICPP_DETAIL_INLINE void report_error(StringT message);
+
+    MIMICPP_DETAIL_INLINE void report_unhandled_exception(
+        CallReport callReport,
+        ExpectationReport expectationReport,
+        const std::exception_ptr& exception);
+}
+
+namespace mimicpp
+{
+    /**
+     * \brief Replaces the previous reporter with a newly constructed one.
+     * \tparam T The desired reporter type.
+     * \tparam Args The constructor argument types for ``T``.
+     * \param args The constructor arguments.
+     * \ingroup REPORTING
+     * \details This function accesses the globally available reporter and replaces it with a new instance.
+     */
+    template <std::derived_from<IReporter> T, typename... Args>
+        requires std::constructible_from<T, Args...>
+    void install_reporter(Args&&... args) // NOLINT(cppcoreguidelines-missing-std-forward)
+    {
+        detail::get_reporter() = std::make_unique<T>(
+            std::forward<Args>(args)...);
+    }
+
+    namespace detail
+    {
+        template <typename T>
+        class ReporterInstaller
+        {
+        public:
+            template <typename... Args>
+            explicit ReporterInstaller(Args&&... args)
             {
-                *m_Out << msg << '\n';
+                install_reporter<T>(
+                    std::forward<Args>(args)...);
             }
+        };
+    }
 
-            const std::source_location loc{call.fromLoc};
-            throw UnmatchedCallT{
-                msg,
-                {std::move(call), std::move(matchReports)},
-                loc
-            };
-        }
+    /**
+     * \defgroup REPORTING_ADAPTERS test framework adapters
+     * \ingroup REPORTING
+     * \brief Reporter integrations for various third-party frameworks.
+     * \details These reporters are specialized implementations, which provide seamless integrations of ``mimic++`` into the desired
+     * unit-test framework. Integrations are enabled by simply including the specific header into any source file. The include order
+     * doesn't matter.
+     *
+     * \note Including multiple headers of the ``adapters`` subdirectory into one executable is possible, but with caveats. It's unspecified
+     * which reporter will be active at the program start. So, if you need multiple reporters in one executable, you should explicitly
+     * install the desired reporter on a per test case basis.
+     *
+     *\{
+     */
+}
 
-        [[noreturn]]
-        void report_inapplicable_matches(
-            CallReport call,
-            std::vector<MatchReport> matchReports) override
+// The non-template reporting code, which is compiled just once into the mimicpp::compiled library,
+// when MIMICPP_CONFIG_COMPILED is defined.
+#if !defined(MIMICPP_CONFIG_COMPILED) || defined(MIMICPP_DETAIL_COMPILED_SOURCE)
+
+namespace mimicpp::detail
+{
+    MIMICPP_DETAIL_INLINE StringT stringify_no_match_report(const CallReport& call, const std::span<const MatchReport> matchReports)
+    {
+        PrintBufferT buffer{};
+        PrintIteratorT out{buffer};
+        out = print_literal(std::move(out), "No match for ");
+        out = mimicpp::print(std::move(out), call);
+        out = print_literal(std::move(out), "\n");
+
+        if (std::ranges::empty(matchReports))
+        {
+            out = print_literal(std::move(out), "No expectations available.\n");
+        }
+        else
         {
-            assert(
-                std::ranges::all_of(
-                    matchReports,
-                    std::bind_front(std::equal_to{}, MatchResult::inapplicable),
-                    &evaluate_match_report));
+            out = format::format_to(
+                std::move(out),
+                "{} available expectation(s):\n",
+                std::ranges::size(matchReports));
 
-            const auto msg = detail::stringify_inapplicable_match_report(call, matchReports);
-            if (m_Out)
+            for (const auto& report : matchReports)
             {
-                *m_Out << msg << '\n';
+                out = mimicpp::print(std::move(out), report);
+                out = print_literal(std::move(out), "\n");
             }
+        }
 
-            const std::source_location loc{call.fromLoc};
-            throw UnmatchedCallT{
-                msg,
-                {std::move(call), std::move(matchReports)},
-                loc
-            };
+        stringify_stacktrace(
+            std::move(out),
+            call.stacktrace);
+
+        return to_print_string(std::move(buffer));
+    }
+
+    MIMICPP_DETAIL_INLINE StringT stringify_inapplicable_match_report(const CallReport& call, const std::span<const MatchReport> matchReports)
+    {
+        PrintBufferT buffer{};
+        PrintIteratorT out{buffer};
+        out = print_literal(std::move(out), "No applicable match for ");
+        out = mimicpp::print(std::move(out), call);
+        out = print_literal(std::move(out), "\n");
+
+        out = print_literal(std::move(out), "Tested expectations:\n");
+        for (const auto& report : matchReports)
+        {
+            out = mimicpp::print(std::move(out), report);
+            out = print_literal(std::move(out), "\n");
         }
 
-        void report_full_match(
-            [[maybe_unused]] const CallReport call,
-            [[maybe_unused]] const MatchReport matchReport) noexcept override
+        stringify_stacktrace(
+            std::move(out),
+            call.stacktrace);
+
+        return to_print_string(std::move(buffer));
+    }
+
+    MIMICPP_DETAIL_INLINE StringT stringify_report(const CallReport& call, const MatchReport& matchReport)
+    {
+        PrintBufferT buffer{};
+        PrintIteratorT out{buffer};
+        out = print_literal(std::move(out), "Found match for ");
+        out = mimicpp::print(std::move(out), call);
+        out = print_literal(std::move(out), "\n");
+
+        out = mimicpp::print(std::move(out), matchReport);
+        out = print_literal(std::move(out), "\n");
+
+        stringify_stacktrace(
+            std::move(out),
+            call.stacktrace);
+
+        return to_print_string(std::move(buffer));
+    }
+
+    MIMICPP_DETAIL_INLINE StringT stringify_unfulfilled_expectation(const ExpectationReport& expectationReport)
+    {
+        PrintBufferT buffer{};
+        PrintIteratorT out{buffer};
+        out = print_literal(std::move(out), "Unfulfilled expectation:\n");
+        out = mimicpp::print(std::move(out), expectationReport);
+        print_literal(std::move(out), "\n");
+
+        return to_print_string(std::move(buffer));
+    }
+
+    MIMICPP_DETAIL_INLINE StringT stringify_unhandled_exception(
+        const CallReport& call,
+        const ExpectationReport& expectationReport,
+        const std::exception_ptr& exception)
+    {
+        PrintBufferT buffer{};
+        PrintIteratorT out{buffer};
+        out = print_literal(std::move(out), "Unhandled exception: ");
+
+        try
         {
-            assert(MatchResult::full == evaluate_match_report(matchReport));
+            std::rethrow_exception(exception);
+        }
+        catch (const std::exception& e)
+        {
+            out = format::format_to(
+                std::move(out),
+                "what: {}\n",
+                e.what());
+        }
+        catch (...)
+        {
+            out = print_literal(std::move(out), "Unknown exception type.\n");
         }
 
-        void report_unfulfilled_expectation(
-            ExpectationReport expectationReport) override
+        out = print_literal(std::move(out), "while checking expectation:\n");
+        out = mimicpp::print(std::move(out), expectationReport);
+        out = print_literal(std::move(out), "\n");
+
+        out = print_literal(std::move(out), "For ");
+        out = mimicpp::print(std::move(out), call);
+        print_literal(std::move(out), "\n");
+
+        return to_print_string(std::move(buffer));
+    }
+}
+
+namespace mimicpp
+{
+    MIMICPP_DETAIL_INLINE void DefaultReporter::report_no_matches(
+        CallReport call,
+        std::vector<MatchReport> matchReports)
+    {
+        assert(
+            std::ranges::all_of(
+                matchReports,
+                std::bind_front(std::equal_to{}, MatchResult::none),
+                &evaluate_match_report));
+
+        const auto msg = detail::stringify_no_match_report(call, matchReports);
+        if (m_Out)
         {
-            if (0 == std::uncaught_exceptions())
-            {
-                const auto msg = detail::stringify_unfulfilled_expectation(expectationReport);
-                if (m_Out)
-                {
-                    *m_Out << msg << '\n';
-                }
-
-                throw UnfulfilledExpectationT{
-                    msg,
-                    std::move(expectationReport)};
-            }
+            *m_Out << msg << '\n';
         }
 
-        void report_error(const StringT message) override
+        const std::source_location loc{call.fromLoc};
+        throw UnmatchedCallT{
+            msg,
+            {std::move(call), std::move(matchReports)},
+            loc
+        };
+    }
+
+    MIMICPP_DETAIL_INLINE void DefaultReporter::report_inapplicable_matches(
+        CallReport call,
+        std::vector<MatchReport> matchReports)
+    {
+        assert(
+            std::ranges::all_of(
+                matchReports,
+                std::bind_front(std::equal_to{}, MatchResult::inapplicable),
+                &evaluate_match_report));
+
+        const auto msg = detail::stringify_inapplicable_match_report(call, matchReports);
+        if (m_Out)
         {
-            if (0 == std::uncaught_exceptions())
-            {
-                if (m_Out)
-                {
-                    *m_Out << message << '\n';
-                }
+            *m_Out << msg << '\n';
+        }
+
+        const std::source_location loc{call.fromLoc};
+        throw UnmatchedCallT{
+            msg,
+            {std::move(call), std::move(matchReports)},
+            loc
+        };
+    }
+
+    MIMICPP_DETAIL_INLINE void DefaultReporter::report_full_match(
+        [[maybe_unused]] const CallReport call,
+        [[maybe_unused]] const MatchReport matchReport) noexcept
+    {
+        assert(MatchResult::full == evaluate_match_report(matchReport));
+    }
 
-                throw Error{message};
+    MIMICPP_DETAIL_INLINE void DefaultReporter::report_unfulfilled_expectation(
+        ExpectationReport expectationReport)
+    {
+        if (0 == std::uncaught_exceptions())
+        {
+            const auto msg = detail::stringify_unfulfilled_expectation(expectationReport);
+            if (m_Out)
+            {
+                *m_Out << msg << '\n';
             }
+
+            throw UnfulfilledExpectationT{
+                msg,
+                std::move(expectationReport)};
         }
+    }
 
-        void report_unhandled_exception(
-            const CallReport call,
-            const ExpectationReport expectationReport,
-            const std::exception_ptr exception) override
+    MIMICPP_DETAIL_INLINE void DefaultReporter::report_error(const StringT message)
+    {
+        if (0 == std::uncaught_exceptions())
         {
             if (m_Out)
             {
-                *m_Out << detail::stringify_unhandled_exception(call, expectationReport, exception)
-                       << '\n';
+                *m_Out << message << '\n';
             }
-        }
 
-    private:
-        std::ostream* m_Out;
-    };
+            throw Error{message};
+        }
+    }
 
-    /**
-     * \}
-     */
+    MIMICPP_DETAIL_INLINE void DefaultReporter::report_unhandled_exception(
+        const CallReport call,
+        const ExpectationReport expectationReport,
+        const std::exception_ptr exception)
+    {
+        if (m_Out)
+        {
+            *m_Out << detail::stringify_unhandled_exception(call, expectationReport, exception)
+                   << '\n';
+        }
+    }
 }
 
 namespace mimicpp::detail
 {
-    [[nodiscard]]
-    inline std::unique_ptr<IReporter>& get_reporter() noexcept
+    MIMICPP_DETAIL_INLINE std::unique_ptr<IReporter>& get_reporter() noexcept
     {
         static std::unique_ptr<IReporter> reporter{
             std::make_unique<DefaultReporter>(&std::cerr)};
         return reporter;
     }
 
-    [[noreturn]]
-    inline void report_no_matches(
+    MIMICPP_DETAIL_INLINE void report_no_matches(
         CallReport callReport,
         std::vector<MatchReport> matchReports)
     {
@@ -574,8 +697,7 @@ namespace mimicpp::detail
         // GCOVR_EXCL_STOP
     }
 
-    [[noreturn]]
-    inline void report_inapplicable_matches(
+    MIMICPP_DETAIL_INLINE void report_inapplicable_matches(
         CallReport callReport,
         std::vector<MatchReport> matchReports)
     {
@@ -592,7 +714,24 @@ namespace mimicpp::detail
         // GCOVR_EXCL_STOP
     }
 
-    inline void report_full_match(
+    MIMICPP_DETAIL_INLINE void report_unmatched_call(
+        CallReport callReport,
+        std::vector<MatchReport> noMatchReports,
+        std::vector<MatchReport> inapplicableMatchReports)
+    {
+        if (!std::ranges::empty(inapplicableMatchReports))
+        {
+            report_inapplicable_matches(
+                std::move(callReport),
+                std::move(inapplicableMatchReports));
+        }
+
+        report_no_matches(
+            std::move(callReport),
+            std::move(noMatchReports));
+    }
+
+    MIMICPP_DETAIL_INLINE void report_full_match(
         CallReport callReport,
         MatchReport matchReport) noexcept
     {
@@ -602,20 +741,20 @@ namespace mimicpp::detail
                 std::move(matchReport));
     }
 
-    inline void report_unfulfilled_expectation(
+    MIMICPP_DETAIL_INLINE void report_unfulfilled_expectation(
         ExpectationReport expectationReport)
     {
         get_reporter()
             ->report_unfulfilled_expectation(std::move(expectationReport));
     }
 
-    inline void report_error(StringT message)
+    MIMICPP_DETAIL_INLINE void report_error(StringT message)
     {
         get_reporter()
             ->report_error(std::move(message));
     }
 
-    inline void report_unhandled_exception(
+    MIMICPP_DETAIL_INLINE void report_unhandled_exception(
         CallReport callReport,
         ExpectationReport expectationReport,
         const std::exception_ptr& exception)
@@ -628,53 +767,6 @@ namespace mimicpp::detail
     }
 }
 
-namespace mimicpp
-{
-    /**
-     * \brief Replaces the previous reporter with a newly constructed one.
-     * \tparam T The desired reporter type.
-     * \tparam Args The constructor argument types for ``T``.
-     * \param args The constructor arguments.
-     * \ingroup REPORTING
-     * \details This function accesses the globally available reporter and replaces it with a new instance.
-     */
-    template <std::derived_from<IReporter> T, typename... Args>
-        requires std::constructible_from<T, Args...>
-    void install_reporter(Args&&... args) // NOLINT(cppcoreguidelines-missing-std-forward)
-    {
-        detail::get_reporter() = std::make_unique<T>(
-            std::forward<Args>(args)...);
-    }
-
-    namespace detail
-    {
-        template <typename T>
-        class ReporterInstaller
-        {
-        public:
-            template <typename... Args>
-            explicit ReporterInstaller(Args&&... args)
-            {
-                install_reporter<T>(
-                    std::forward<Args>(args)...);
-            }
-        };
-    }
-
-    /**
-     * \defgroup REPORTING_ADAPTERS test framework adapters
-     * \ingroup REPORTING
-     * \brief Reporter integrations for various third-party frameworks.
-     * \details These reporters are specialized implementations, which provide seamless integrations of ``mimic++`` into the desired
-     * unit-test framework. Integrations are enabled by simply including the specific header into any source file. The include order
-     * doesn't matter.
-     *
-     * \note Including multiple headers of the ``adapters`` subdirectory into one executable is possible, but with caveats. It's unspecified
-     * which reporter will be active at the program start. So, if you need multiple reporters in one executable, you should explicitly
-     * install the desired reporter on a per test case basis.
-     *
-     *\{
-     */
-}
+#endif
 
 #endif
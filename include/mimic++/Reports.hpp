@@ -261,6 +261,12 @@ namespace mimicpp
             .fromConstness = callInfo.fromConstness};
     }
 
+    namespace detail
+    {
+        [[nodiscard]]
+        MIMICPP_DETAIL_INLINE PrintIteratorT print_call_report(PrintIteratorT out, const CallReport& report);
+    }
+
     template <>
     class detail::Printer<CallReport>
     {
@@ -268,57 +274,7 @@ namespace mimicpp
         template <print_iterator OutIter>
         static OutIter print(OutIter out, const CallReport& report)
         {
-            out = format::format_to(
-                std::move(out),
-                "call from ");
-            if (!report.stacktrace.empty())
-            {
-                out = format::format_to(
-                    std::move(out),
-                    "{} [{}], {}",
-                    report.stacktrace.source_file(0u),
-                    report.stacktrace.source_line(0u),
-                    report.stacktrace.description(0u));
-            }
-            else
-            {
-                out = mimicpp::print(
-                    std::move(out),
-                    report.fromLoc);
-            }
-            out = format::format_to(
-                std::move(out),
-                "\n");
-
-            out = format::format_to(
-                std::move(out),
-                "constness: {}\n"
-                "value category: {}\n"
-                "return type: {}\n",
-                report.fromConstness,
-                report.fromCategory,
-                report.returnTypeIndex.name());
-
-            if (!std::ranges::empty(report.argDetails))
-            {
-                out = format::format_to(
-                    std::move(out),
-                    "args:\n");
-                for (const std::size_t i : std::views::iota(0u, std::ranges::size(report.argDetails)))
-                {
-                    out = format::format_to(
-                        std::move(out),
-                        "\targ[{}]: {{\n"
-                        "\t\ttype: {},\n"
-                        "\t\tvalue: {}\n"
-                        "\t}},\n",
-                        i,
-                        report.argDetails[i].typeIndex.name(),
-                        report.argDetails[i].stateString);
-                }
-            }
-
-            return out;
+            return print_via(std::move(out), &print_call_report, report);
         }
     };
 
@@ -347,6 +303,12 @@ namespace mimicpp
         }
     };
 
+    namespace detail
+    {
+        [[nodiscard]]
+        MIMICPP_DETAIL_INLINE PrintIteratorT print_expectation_report(PrintIteratorT out, const ExpectationReport& report);
+    }
+
     template <>
     class detail::Printer<ExpectationReport>
     {
@@ -354,57 +316,7 @@ namespace mimicpp
         template <print_iterator OutIter>
         static OutIter print(OutIter out, const ExpectationReport& report)
         {
-            out = format::format_to(
-                std::move(out),
-                "Expectation report:\n");
-
-            if (report.sourceLocation)
-            {
-                out = format::format_to(
-                    std::move(out),
-                    "from: ");
-                out = mimicpp::print(
-                    std::move(out),
-                    *report.sourceLocation);
-                out = format::format_to(
-                    std::move(out),
-                    "\n");
-            }
-
-            if (report.timesDescription)
-            {
-                out = format::format_to(
-                    out,
-                    "times: {}\n",
-                    *report.timesDescription);
-            }
-
-            if (std::ranges::any_of(
-                    report.expectationDescriptions,
-                    [](const auto& desc) { return desc.has_value(); }))
-            {
-                out = format::format_to(
-                    std::move(out),
-                    "expects:\n");
-                for (const auto& desc : report.expectationDescriptions
-                                            | std::views::filter([](const auto& desc) { return desc.has_value(); }))
-                {
-                    out = format::format_to(
-                        std::move(out),
-                        "\t{},\n",
-                        *desc);
-                }
-            }
-
-            if (report.finalizerDescription)
-            {
-                out = format::format_to(
-                    std::move(out),
-                    "finally: {}\n",
-                    *report.finalizerDescription);
-            }
-
-            return out;
+            return print_via(std::move(out), &print_expectation_report, report);
         }
     };
 
@@ -480,6 +392,12 @@ namespace mimicpp
         return MatchResult::full;
     }
 
+    namespace detail
+    {
+        [[nodiscard]]
+        MIMICPP_DETAIL_INLINE PrintIteratorT print_match_report(PrintIteratorT out, const MatchReport& report);
+    }
+
     template <>
     class detail::Printer<MatchReport>
     {
@@ -487,105 +405,229 @@ namespace mimicpp
         template <print_iterator OutIter>
         static OutIter print(OutIter out, const MatchReport& report)
         {
-            std::vector<StringT> matchedExpectationDescriptions{};
-            std::vector<StringT> unmatchedExpectationDescriptions{};
+            return print_via(std::move(out), &print_match_report, report);
+        }
+    };
 
-            for (const auto& [isMatching, description] : report.expectationReports)
-            {
-                if (description)
-                {
-                    if (isMatching)
-                    {
-                        matchedExpectationDescriptions.emplace_back(*description);
-                    }
-                    else
-                    {
-                        unmatchedExpectationDescriptions.emplace_back(*description);
-                    }
-                }
-            }
+    /**
+     * \}
+     */
+}
 
-            switch (evaluate_match_report(report))
+// The non-template report printers, which are compiled just once into the mimicpp::compiled library,
+// when MIMICPP_CONFIG_COMPILED is defined.
+#if !defined(MIMICPP_CONFIG_COMPILED) || defined(MIMICPP_DETAIL_COMPILED_SOURCE)
+
+namespace mimicpp::detail
+{
+    MIMICPP_DETAIL_INLINE PrintIteratorT print_call_report(PrintIteratorT out, const CallReport& report)
+    {
+        out = format::format_to(
+            std::move(out),
+            "call from ");
+        if (!report.stacktrace.empty())
+        {
+            out = format::format_to(
+                std::move(out),
+                "{} [{}], {}",
+                report.stacktrace.source_file(0u),
+                report.stacktrace.source_line(0u),
+                report.stacktrace.description(0u));
+        }
+        else
+        {
+            out = mimicpp::print(
+                std::move(out),
+                report.fromLoc);
+        }
+        out = format::format_to(
+            std::move(out),
+            "\n");
+
+        out = format::format_to(
+            std::move(out),
+            "constness: {}\n"
+            "value category: {}\n"
+            "return type: {}\n",
+            report.fromConstness,
+            report.fromCategory,
+            report.returnTypeIndex.name());
+
+        if (!std::ranges::empty(report.argDetails))
+        {
+            out = format::format_to(
+                std::move(out),
+                "args:\n");
+            for (const std::size_t i : std::views::iota(0u, std::ranges::size(report.argDetails)))
             {
-            case MatchResult::full:
                 out = format::format_to(
                     std::move(out),
-                    "Matched expectation: {{\n");
-                break;
+                    "\targ[{}]: {{\n"
+                    "\t\ttype: {},\n"
+                    "\t\tvalue: {}\n"
+                    "\t}},\n",
+                    i,
+                    report.argDetails[i].typeIndex.name(),
+                    report.argDetails[i].stateString);
+            }
+        }
 
-            case MatchResult::inapplicable:
-                out = format::format_to(
-                    std::move(out),
-                    "Inapplicable, but otherwise matched expectation: {{\n"
-                    "reason: ");
-                out = std::visit(
-                    std::bind_front(control_state_printer{}, std::move(out)),
-                    report.controlReport);
-                out = format::format_to(std::move(out), "\n");
-                break;
-
-            case MatchResult::none:
-                out = format::format_to(
-                    std::move(out),
-                    "Unmatched expectation: {{\n");
-                break;
+        return out;
+    }
 
-            // GCOVR_EXCL_START
-            default: // NOLINT(clang-diagnostic-covered-switch-default)
-                unreachable();
-                // GCOVR_EXCL_STOP
-            }
+    MIMICPP_DETAIL_INLINE PrintIteratorT print_expectation_report(PrintIteratorT out, const ExpectationReport& report)
+    {
+        out = format::format_to(
+            std::move(out),
+            "Expectation report:\n");
 
-            if (report.sourceLocation)
+        if (report.sourceLocation)
+        {
+            out = format::format_to(
+                std::move(out),
+                "from: ");
+            out = mimicpp::print(
+                std::move(out),
+                *report.sourceLocation);
+            out = format::format_to(
+                std::move(out),
+                "\n");
+        }
+
+        if (report.timesDescription)
+        {
+            out = format::format_to(
+                out,
+                "times: {}\n",
+                *report.timesDescription);
+        }
+
+        if (std::ranges::any_of(
+                report.expectationDescriptions,
+                [](const auto& desc) { return desc.has_value(); }))
+        {
+            out = format::format_to(
+                std::move(out),
+                "expects:\n");
+            for (const auto& desc : report.expectationDescriptions
+                                        | std::views::filter([](const auto& desc) { return desc.has_value(); }))
             {
                 out = format::format_to(
                     std::move(out),
-                    "from: ");
-                out = mimicpp::print(
-                    std::move(out),
-                    *report.sourceLocation);
-                out = format::format_to(
-                    std::move(out),
-                    "\n");
+                    "\t{},\n",
+                    *desc);
             }
+        }
+
+        if (report.finalizerDescription)
+        {
+            out = format::format_to(
+                std::move(out),
+                "finally: {}\n",
+                *report.finalizerDescription);
+        }
+
+        return out;
+    }
+
+    MIMICPP_DETAIL_INLINE PrintIteratorT print_match_report(PrintIteratorT out, const MatchReport& report)
+    {
+        std::vector<StringT> matchedExpectationDescriptions{};
+        std::vector<StringT> unmatchedExpectationDescriptions{};
 
-            if (!std::ranges::empty(unmatchedExpectationDescriptions))
+        for (const auto& [isMatching, description] : report.expectationReports)
+        {
+            if (description)
             {
-                out = format::format_to(
-                    std::move(out),
-                    "failed:\n");
-                for (const auto& desc : unmatchedExpectationDescriptions)
+                if (isMatching)
                 {
-                    out = format::format_to(
-                        std::move(out),
-                        "\t{},\n",
-                        desc);
+                    matchedExpectationDescriptions.emplace_back(*description);
+                }
+                else
+                {
+                    unmatchedExpectationDescriptions.emplace_back(*description);
                 }
             }
+        }
+
+        switch (evaluate_match_report(report))
+        {
+        case MatchResult::full:
+            out = format::format_to(
+                std::move(out),
+                "Matched expectation: {{\n");
+            break;
+
+        case MatchResult::inapplicable:
+            out = format::format_to(
+                std::move(out),
+                "Inapplicable, but otherwise matched expectation: {{\n"
+                "reason: ");
+            out = std::visit(
+                std::bind_front(control_state_printer{}, std::move(out)),
+                report.controlReport);
+            out = format::format_to(std::move(out), "\n");
+            break;
+
+        case MatchResult::none:
+            out = format::format_to(
+                std::move(out),
+                "Unmatched expectation: {{\n");
+            break;
+
+        // GCOVR_EXCL_START
+        default: // NOLINT(clang-diagnostic-covered-switch-default)
+            unreachable();
+            // GCOVR_EXCL_STOP
+        }
+
+        if (report.sourceLocation)
+        {
+            out = format::format_to(
+                std::move(out),
+                "from: ");
+            out = mimicpp::print(
+                std::move(out),
+                *report.sourceLocation);
+            out = format::format_to(
+                std::move(out),
+                "\n");
+        }
 
-            if (!std::ranges::empty(matchedExpectationDescriptions))
+        if (!std::ranges::empty(unmatchedExpectationDescriptions))
+        {
+            out = format::format_to(
+                std::move(out),
+                "failed:\n");
+            for (const auto& desc : unmatchedExpectationDescriptions)
             {
                 out = format::format_to(
                     std::move(out),
-                    "passed:\n");
-                for (const auto& desc : matchedExpectationDescriptions)
-                {
-                    out = format::format_to(
-                        std::move(out),
-                        "\t{},\n",
-                        desc);
-                }
+                    "\t{},\n",
+                    desc);
             }
+        }
 
-            return format::format_to(
+        if (!std::ranges::empty(matchedExpectationDescriptions))
+        {
+            out = format::format_to(
                 std::move(out),
-                "}}\n");
+                "passed:\n");
+            for (const auto& desc : matchedExpectationDescriptions)
+            {
+                out = format::format_to(
+                    std::move(out),
+                    "\t{},\n",
+                    desc);
+            }
         }
-    };
 
-    /**
-     * \}
-     */
+        return format::format_to(
+            std::move(out),
+            "}}\n");
+    }
 }
 
 #endif
+
+#endif
@@ -0,0 +1,204 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MIMICPP_SPY_HPP
+#define MIMICPP_SPY_HPP
+
+#pragma once
+
+#include "mimic++/Call.hpp"
+#include "mimic++/Expectation.hpp"
+#include "mimic++/Fwd.hpp"
+#include "mimic++/TypeTraits.hpp"
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace mimicpp::detail
+{
+    /**
+     * \brief Determines, how a parameter is passed to the spy.
+     * \details By-value parameters are usually owned by the mock and thus can be moved into the spy.
+     * But if the mock borrows them from the caller (as ``ForwardingMock`` does), they are passed as lvalues instead,
+     * so that the caller's objects are copied and never moved from.
+     */
+    template <typename Param, bool borrowedParams>
+    using spy_arg_t = std::conditional_t<
+        borrowedParams && !std::is_reference_v<Param>,
+        Param&,
+        Param&&>;
+
+    template <typename Signature, typename Fun, bool borrowedParams, typename ParamList = signature_param_list_t<Signature>>
+    class ForwardingFallback;
+
+    template <typename Signature, typename Fun, bool borrowedParams, typename... Params>
+    class ForwardingFallback<Signature, Fun, borrowedParams, type_list<Params...>> final
+        : public CallFallback<Signature>
+    {
+    public:
+        using CallInfoT = call::info_for_signature_t<Signature>;
+        using ReturnT = signature_return_type_t<Signature>;
+
+        [[nodiscard]]
+        explicit ForwardingFallback(Fun fun) noexcept(std::is_nothrow_move_constructible_v<Fun>)
+            : m_Fun{std::move(fun)}
+        {
+        }
+
+        [[nodiscard]]
+        ReturnT handle_call(const CallInfoT& call) override
+        {
+            return std::invoke(
+                [&]<std::size_t... indices>([[maybe_unused]] const std::index_sequence<indices...>) -> ReturnT {
+                    return std::invoke(
+                        m_Fun,
+                        static_cast<spy_arg_t<Params, borrowedParams>>(std::get<indices>(call.args).get())...);
+                },
+                std::index_sequence_for<Params...>{});
+        }
+
+    private:
+        Fun m_Fun;
+    };
+
+    template <typename Fun, typename Signature, bool borrowedParams = false, typename ParamList = signature_param_list_t<Signature>>
+    struct is_spy_target_for
+        : public std::false_type
+    {
+    };
+
+    template <typename Fun, typename Signature, bool borrowedParams, typename... Params>
+    struct is_spy_target_for<Fun, Signature, borrowedParams, type_list<Params...>>
+        : public std::bool_constant<
+              std::is_invocable_r_v<signature_return_type_t<Signature>, Fun&, spy_arg_t<Params, borrowedParams>...>>
+    {
+    };
+
+    template <typename Fun, typename Signature>
+    concept borrowing_spy_target_for = std::is_move_constructible_v<Fun>
+                                    && is_spy_target_for<Fun, Signature, true>::value;
+}
+
+namespace mimicpp
+{
+    /**
+     * \defgroup SPY spies
+     * \ingroup MOCK
+     * \brief Spies forward all calls, which are not matched by any expectation, to a real implementation.
+     * \details This lets users wrap real objects and just intercept the few calls they are interested in.
+     * Calls which match any expectation (even if that's saturated) are handled as usual, but all other calls are directly
+     * forwarded to the installed function.
+     * The pass-through path doesn't generate any reports, so it's nearly as cheap as a plain (virtual) function call.
+     *
+     * Spies can be installed on any signature of a ``Mock`` via ``spy_on`` and are active until the returned ``ScopedSpy``
+     * is destroyed.
+     * That's especially useful for interface-mocks, as each mocked method can be forwarded to a real object.
+     * \snippet InterfaceMock.cpp interface mock spy
+     *
+     * \note All signatures, which just differ in their qualification, share the same spy.
+     *
+     * \{
+     */
+
+    /**
+     * \brief Determines, whether the given type can be installed as spy for the given signature.
+     * \details The function must be invocable with all (forwarded) parameters and return something, which is
+     * convertible to the return type.
+     */
+    template <typename Fun, typename Signature>
+    concept spy_target_for = std::is_move_constructible_v<Fun>
+                          && detail::is_spy_target_for<Fun, Signature>::value;
+
+    /**
+     * \brief Keeps a spy installed for its whole lifetime.
+     * \tparam Signature The decayed signature.
+     */
+    template <typename Signature>
+        requires std::same_as<Signature, signature_decay_t<Signature>>
+    class ScopedSpy
+    {
+    public:
+        /**
+         * \brief Uninstalls the spy.
+         */
+        ~ScopedSpy() noexcept
+        {
+            if (m_Collection)
+            {
+                m_Collection->reset_fallback();
+            }
+        }
+
+        /**
+         * \brief Installs the given fallback on the given collection.
+         * \param collection The target collection.
+         * \param fallback The fallback to be installed.
+         * \note Users should prefer the ``spy_on`` member function of mocks.
+         */
+        [[nodiscard]]
+        explicit ScopedSpy(
+            std::shared_ptr<ExpectationCollection<Signature>> collection,
+            std::shared_ptr<CallFallback<Signature>> fallback)
+            : m_Collection{std::move(collection)}
+        {
+            assert(m_Collection && "Collection is nullptr.");
+            assert(fallback && "Fallback is nullptr.");
+
+            m_Collection->set_fallback(std::move(fallback));
+        }
+
+        /**
+         * \brief Deleted copy-constructor.
+         */
+        ScopedSpy(const ScopedSpy&) = delete;
+
+        /**
+         * \brief Deleted copy-assignment-operator.
+         */
+        ScopedSpy& operator=(const ScopedSpy&) = delete;
+
+        /**
+         * \brief Move-constructor.
+         */
+        [[nodiscard]]
+        ScopedSpy(ScopedSpy&& other) noexcept
+            : m_Collection{std::exchange(other.m_Collection, nullptr)}
+        {
+        }
+
+        /**
+         * \brief Move-assignment-operator, which uninstalls the current spy first.
+         */
+        ScopedSpy& operator=(ScopedSpy&& other) noexcept
+        {
+            if (this != std::addressof(other))
+            {
+                if (m_Collection)
+                {
+                    m_Collection->reset_fallback();
+                }
+
+                m_Collection = std::exchange(other.m_Collection, nullptr);
+            }
+
+            return *this;
+        }
+
+    private:
+        std::shared_ptr<ExpectationCollection<Signature>> m_Collection;
+    };
+
+    /**
+     * \}
+     */
+}
+
+#endif
@@ -374,6 +374,12 @@ namespace mimicpp::stacktrace
     constexpr detail::current_hook::current_fn current{};
 }
 
+namespace mimicpp::detail
+{
+    [[nodiscard]]
+    MIMICPP_DETAIL_INLINE PrintIteratorT print_stacktrace(PrintIteratorT out, const Stacktrace& stacktrace);
+}
+
 template <>
 class mimicpp::detail::Printer<mimicpp::Stacktrace>
 {
@@ -381,24 +387,7 @@ public:
     template <print_iterator OutIter>
     static OutIter print(OutIter out, const Stacktrace& stacktrace)
     {
-        if (stacktrace.empty())
-        {
-            return format::format_to(
-                std::move(out),
-                "empty");
-        }
-
-        for (const std::size_t i : std::views::iota(0u, stacktrace.size()))
-        {
-            out = format::format_to(
-                std::move(out),
-                "{} [{}], {}\n",
-                stacktrace.source_file(i),
-                stacktrace.source_line(i),
-                stacktrace.description(i));
-        }
-
-        return out;
+        return print_via(std::move(out), &print_stacktrace, stacktrace);
     }
 };
 
@@ -652,4 +641,35 @@ struct mimicpp::stacktrace::find_backend
 
 #endif
 
+// The non-template stacktrace printer, which is compiled just once into the mimicpp::compiled library,
+// when MIMICPP_CONFIG_COMPILED is defined.
+#if !defined(MIMICPP_CONFIG_COMPILED) || defined(MIMICPP_DETAIL_COMPILED_SOURCE)
+
+namespace mimicpp::detail
+{
+    MIMICPP_DETAIL_INLINE PrintIteratorT print_stacktrace(PrintIteratorT out, const Stacktrace& stacktrace)
+    {
+        if (stacktrace.empty())
+        {
+            return format::format_to(
+                std::move(out),
+                "empty");
+        }
+
+        for (const std::size_t i : std::views::iota(0u, stacktrace.size()))
+        {
+            out = format::format_to(
+                std::move(out),
+                "{} [{}], {}\n",
+                stacktrace.source_file(i),
+                stacktrace.source_line(i),
+                stacktrace.description(i));
+        }
+
+        return out;
+    }
+}
+
+#endif
+
 #endif
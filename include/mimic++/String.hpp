@@ -12,6 +12,8 @@
 #include "mimic++/Utility.hpp"
 
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <ranges>
 #include <string>
@@ -357,6 +359,10 @@ namespace mimicpp
      * \see https://www.unicode.org/Public/UNIDATA/CaseFolding.txt
      *
      * \note Users are allowed to add specializations as desired.
+     *
+     * Converters may additionally provide a static ``code_point_boundary(view, pos)`` function, which moves ``pos``
+     * backwards onto the start of the code-point it's part of. As case-folding is context-free, strings can then be folded
+     * piece by piece without splitting any code-point, which lets the string-matchers stop at the first mismatch.
      */
 
     /**
@@ -396,25 +402,47 @@ namespace mimicpp::detail
 
 #ifndef MIMICPP_CONFIG_EXPERIMENTAL_UNICODE_STR_MATCHER
 
+namespace mimicpp::detail
+{
+    /**
+     * \brief Converts ascii lower-case letters to their upper-case counterpart. All other characters are returned unchanged.
+     * \details In contrast to ``std::toupper``, this is independent of the current locale and branch-free, which makes
+     * loops over it vectorizable.
+     */
+    [[nodiscard]]
+    constexpr char ascii_to_upper(const char c) noexcept
+    {
+        return static_cast<char>(
+            c - static_cast<int>('a' <= c && c <= 'z') * ('a' - 'A'));
+    }
+}
+
 /**
  * \brief Specialized template for the ``char`` type.
  * \ingroup TYPE_TRAITS_STRING_CASE_FOLD_CONVERTER
+ * \details Just the ascii letters are folded; all other characters are left untouched.
+ * \note This approach will fail, if the string actually contains an utf8-encoded string.
  */
 template <>
 struct mimicpp::string_case_fold_converter<char>
 {
+    /**
+     * \brief Folds a single character.
+     * \details As the folding of each character is independent of its neighbours, the string-matchers can compare
+     * contiguous strings element-wise, without converting them first.
+     */
+    [[nodiscard]]
+    static constexpr char fold(const char c) noexcept
+    {
+        return detail::ascii_to_upper(c);
+    }
+
     template <detail::compatible_string_view_with<char> String>
     [[nodiscard]]
     constexpr auto operator()(String&& str) const
     {
         return std::views::all(std::forward<String>(str))
-             | std::views::transform(
-                   [](const char c) noexcept {
-                       // see notes of https://en.cppreference.com/w/cpp/string/byte/toupper
-                       // This approach will fail, if str actually contains an utf8-encoded string.
-                       return static_cast<char>(
-                           static_cast<unsigned char>(std::toupper(c)));
-                   });
+             | std::views::transform(&string_case_fold_converter::fold);
     }
 };
 
@@ -428,6 +456,46 @@ struct mimicpp::string_case_fold_converter<char>
         #error "Unable to find uni_algo includes."
     #endif
 
+namespace mimicpp::detail
+{
+    /**
+     * \brief Moves the given position backwards onto the start of the utf8-code-point it's part of.
+     */
+    template <typename Char>
+    [[nodiscard]]
+    constexpr std::size_t utf8_code_point_boundary(const std::basic_string_view<Char> str, std::size_t pos) noexcept
+    {
+        // continuation bytes have the form 10xxxxxx
+        while (0u < pos
+               && pos < str.size()
+               && 0x80u == (static_cast<unsigned char>(str[pos]) & 0xC0u))
+        {
+            --pos;
+        }
+
+        return pos;
+    }
+
+    /**
+     * \brief Moves the given position backwards onto the start of the utf16-code-point it's part of.
+     */
+    template <typename Char>
+    [[nodiscard]]
+    constexpr std::size_t utf16_code_point_boundary(const std::basic_string_view<Char> str, std::size_t pos) noexcept
+    {
+        // low surrogates must not be separated from their preceding high surrogate
+        if (0u < pos
+            && pos < str.size()
+            && 0xDC00u <= static_cast<std::uint32_t>(str[pos])
+            && static_cast<std::uint32_t>(str[pos]) <= 0xDFFFu)
+        {
+            --pos;
+        }
+
+        return pos;
+    }
+}
+
 /**
  * \brief Specialized template for the ``char`` type (with uni_algo backend).
  * \ingroup TYPE_TRAITS_STRING_CASE_FOLD_CONVERTER
@@ -435,6 +503,15 @@ struct mimicpp::string_case_fold_converter<char>
 template <>
 struct mimicpp::string_case_fold_converter<char>
 {
+    /**
+     * \brief Moves the given position backwards onto the start of the utf8-code-point it's part of.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t code_point_boundary(const std::string_view str, const std::size_t pos) noexcept
+    {
+        return detail::utf8_code_point_boundary(str, pos);
+    }
+
     template <detail::compatible_string_view_with<char> String>
     [[nodiscard]]
     constexpr auto operator()(String&& str) const
@@ -453,6 +530,15 @@ struct mimicpp::string_case_fold_converter<char>
 template <>
 struct mimicpp::string_case_fold_converter<wchar_t>
 {
+    /**
+     * \brief Moves the given position backwards onto the start of the utf16-code-point it's part of.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t code_point_boundary(const std::wstring_view str, const std::size_t pos) noexcept
+    {
+        return detail::utf16_code_point_boundary(str, pos);
+    }
+
     template <detail::compatible_string_view_with<wchar_t> String>
     [[nodiscard]]
     constexpr auto operator()(String&& str) const
@@ -471,6 +557,15 @@ struct mimicpp::string_case_fold_converter<wchar_t>
 template <>
 struct mimicpp::string_case_fold_converter<char8_t>
 {
+    /**
+     * \brief Moves the given position backwards onto the start of the utf8-code-point it's part of.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t code_point_boundary(const std::u8string_view str, const std::size_t pos) noexcept
+    {
+        return detail::utf8_code_point_boundary(str, pos);
+    }
+
     template <detail::compatible_string_view_with<char8_t> String>
     [[nodiscard]]
     constexpr auto operator()(String&& str) const
@@ -489,6 +584,15 @@ struct mimicpp::string_case_fold_converter<char8_t>
 template <>
 struct mimicpp::string_case_fold_converter<char16_t>
 {
+    /**
+     * \brief Moves the given position backwards onto the start of the utf16-code-point it's part of.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t code_point_boundary(const std::u16string_view str, const std::size_t pos) noexcept
+    {
+        return detail::utf16_code_point_boundary(str, pos);
+    }
+
     template <detail::compatible_string_view_with<char16_t> String>
     [[nodiscard]]
     constexpr auto operator()(String&& str) const
@@ -507,6 +611,15 @@ struct mimicpp::string_case_fold_converter<char16_t>
 template <>
 struct mimicpp::string_case_fold_converter<char32_t>
 {
+    /**
+     * \brief Returns the given position unchanged, as each element is a whole code-point.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t code_point_boundary([[maybe_unused]] const std::u32string_view str, const std::size_t pos) noexcept
+    {
+        return pos;
+    }
+
     template <detail::compatible_string_view_with<char32_t> String>
     [[nodiscard]]
     constexpr auto operator()(String&& str) const
@@ -8,7 +8,7 @@
 
 #pragma once
 
-#include "Fwd.hpp"
+#include "mimic++/Fwd.hpp"
 
 #include <concepts>
 #include <cstddef>
@@ -18,158 +18,54 @@
 
 namespace mimicpp::detail
 {
+    /**
+     * \brief Decomposes signatures with the default call-convention.
+     * \details Each signature is matched just once against all qualification combinations and all other signature
+     * type-traits are then served by this single instantiation, instead of repeating that matching for each of them.
+     * The primary template is selected for signatures with any other call-convention (and non-signature types).
+     */
     template <typename Signature>
-    struct has_default_call_convention
-        : public std::false_type
-    {
-    };
-
-    template <typename Signature>
-    inline constexpr bool has_default_call_convention_v = has_default_call_convention<Signature>::value;
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params...)>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params..., ...)>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params...) noexcept>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params..., ...) noexcept>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params...) const>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params..., ...) const>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params...) const noexcept>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params..., ...) const noexcept>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params...)&>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params..., ...)&>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params...) & noexcept>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params..., ...) & noexcept>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params...) const&>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params..., ...) const&>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params...) const & noexcept>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params..., ...) const & noexcept>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params...) &&>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params..., ...) &&>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params...) && noexcept>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params..., ...) && noexcept>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params...) const&&>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params..., ...) const&&>
-        : public std::true_type
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params...) const && noexcept>
-        : public std::true_type
-    {
-    };
+    struct default_signature_traits
+    {
+        static constexpr bool isDefault{false};
+    };
+
+#define MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS_FOR(const_spec, ref_spec, noexcept_spec, constness, category, is_noexcept, ...) \
+    template <typename Return, typename... Params>                                                                                  \
+    struct default_signature_traits<Return(__VA_ARGS__) const_spec ref_spec noexcept_spec>                                          \
+    {                                                                                                                               \
+        static constexpr bool isDefault{true};                                                                                      \
+        static constexpr Constness constQualification{Constness::constness};                                                        \
+        static constexpr ValueCategory refQualification{ValueCategory::category};                                                   \
+        static constexpr bool isNoexcept{is_noexcept};                                                                              \
+                                                                                                                                    \
+        using return_t = Return;                                                                                                    \
+        using decay_t = Return(__VA_ARGS__);                                                                                        \
+        using add_noexcept_t = Return(__VA_ARGS__) const_spec ref_spec noexcept;                                                    \
+        using remove_noexcept_t = Return(__VA_ARGS__) const_spec ref_spec;                                                          \
+        using remove_ref_qualifier_t = Return(__VA_ARGS__) const_spec noexcept_spec;                                                \
+        using remove_const_qualifier_t = Return(__VA_ARGS__) ref_spec noexcept_spec;                                                \
+    }
 
-    template <typename Return, typename... Params>
-    struct has_default_call_convention<Return(Params..., ...) const && noexcept>
-        : public std::true_type
-    {
-    };
+#define MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS(const_spec, ref_spec, noexcept_spec, constness, category, is_noexcept)                 \
+    MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS_FOR(const_spec, ref_spec, noexcept_spec, constness, category, is_noexcept, Params...); \
+    MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS_FOR(const_spec, ref_spec, noexcept_spec, constness, category, is_noexcept, Params..., ...)
+
+    MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS(, , , non_const, any, false);
+    MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS(, , noexcept, non_const, any, true);
+    MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS(const, , , as_const, any, false);
+    MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS(const, , noexcept, as_const, any, true);
+    MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS(, &, , non_const, lvalue, false);
+    MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS(, &, noexcept, non_const, lvalue, true);
+    MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS(const, &, , as_const, lvalue, false);
+    MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS(const, &, noexcept, as_const, lvalue, true);
+    MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS(, &&, , non_const, rvalue, false);
+    MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS(, &&, noexcept, non_const, rvalue, true);
+    MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS(const, &&, , as_const, rvalue, false);
+    MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS(const, &&, noexcept, as_const, rvalue, true);
+
+#undef MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS
+#undef MIMICPP_DETAIL_DEFINE_DEFAULT_SIGNATURE_TRAITS_FOR
 
     struct default_call_convention
     {
@@ -189,7 +85,7 @@ namespace mimicpp
      * \tparam Signature The signature to check.
      */
     template <typename Signature>
-    concept has_default_call_convention = detail::has_default_call_convention_v<Signature>;
+    concept has_default_call_convention = detail::default_signature_traits<Signature>::isDefault;
 
     /**
      * \defgroup TYPE_TRAITS_SIGNATURE_CALL_CONVENTION signature_call_convention
@@ -229,538 +125,74 @@ namespace mimicpp
      * template <typename Signature>
      * using add_call_convention_t = // Trait, which adds the call-convention to the signature (if necessary).
 
-     * template <typename Derived, typename Signature>
-     * using call_interface_t = // Interface, which defines ``operator ()`` with the call-convention.
-     * ```
-     *
-     *\{
-     */
-
-    /**
-     * \brief Template specialization for the default call-convention.
-     */
-    template <>
-    struct call_convention_traits<detail::default_call_convention>
-    {
-        using tag_t = detail::default_call_convention;
-
-        template <typename Signature>
-        using remove_call_convention_t = std::type_identity_t<Signature>;
-
-        template <typename Signature>
-        using add_call_convention_t = std::type_identity_t<Signature>;
-
-        template <typename Derived, typename Signature>
-        using call_interface_t = detail::DefaultCallInterface<Derived, Signature>;
-    };
-
-    /**
-     * \}
-     */
-
-    /**
-     * \defgroup TYPE_TRAITS_SIGNATURE_ADD_NOEXCEPT signature_add_noexcept
-     * \ingroup TYPE_TRAITS
-     * \brief Adds the ``noexcept`` specification to a signature.
-     *
-     *\{
-     */
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params...)>
-    {
-        using type = Return(Params...) noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params..., ...)>
-    {
-        using type = Return(Params..., ...) noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params...) noexcept>
-    {
-        using type = Return(Params...) noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params..., ...) noexcept>
-    {
-        using type = Return(Params..., ...) noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params...) const>
-    {
-        using type = Return(Params...) const noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params..., ...) const>
-    {
-        using type = Return(Params..., ...) const noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params...) const noexcept>
-    {
-        using type = Return(Params...) const noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params..., ...) const noexcept>
-    {
-        using type = Return(Params..., ...) const noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params...)&>
-    {
-        using type = Return(Params...) & noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params..., ...)&>
-    {
-        using type = Return(Params..., ...) & noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params...) & noexcept>
-    {
-        using type = Return(Params...) & noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params..., ...) & noexcept>
-    {
-        using type = Return(Params..., ...) & noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params...) const&>
-    {
-        using type = Return(Params...) const& noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params..., ...) const&>
-    {
-        using type = Return(Params..., ...) const& noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params...) const & noexcept>
-    {
-        using type = Return(Params...) const& noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params..., ...) const & noexcept>
-    {
-        using type = Return(Params..., ...) const& noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params...) &&>
-    {
-        using type = Return(Params...) && noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params..., ...) &&>
-    {
-        using type = Return(Params..., ...) && noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params...) && noexcept>
-    {
-        using type = Return(Params...) && noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params..., ...) && noexcept>
-    {
-        using type = Return(Params..., ...) && noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params...) const&&>
-    {
-        using type = Return(Params...) const&& noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params..., ...) const&&>
-    {
-        using type = Return(Params..., ...) const&& noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params...) const && noexcept>
-    {
-        using type = Return(Params...) const&& noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_add_noexcept<Return(Params..., ...) const && noexcept>
-    {
-        using type = Return(Params..., ...) const&& noexcept;
-    };
-
-    /**
-     * \}
-     */
-
-    /**
-     * \defgroup TYPE_TRAITS_SIGNATURE_REMOVE_CALL_CONVENTION signature_remove_call_convention
-     * \ingroup TYPE_TRAITS
-     * \brief Removes the call-convention from a signature (if present).
-     *
-     *\{
-     */
-
-    template <typename Signature>
-    struct signature_remove_call_convention
-    {
-        using type = typename call_convention_traits<
-            signature_call_convention_t<Signature>>::template remove_call_convention_t<Signature>;
-    };
-
-    /**
-     * \}
-     */
-
-    /**
-     * \defgroup TYPE_TRAITS_SIGNATURE_REMOVE_NOEXCEPT signature_remove_noexcept
-     * \ingroup TYPE_TRAITS
-     * \brief Removes the ``noexcept`` specification from a signature (if present).
-     *
-     *\{
-     */
-
-    template <typename Signature>
-        requires(!has_default_call_convention<Signature>)
-    struct signature_remove_noexcept<Signature>
-    {
-        using call_convention_traits_t = call_convention_traits<signature_call_convention_t<Signature>>;
-        using type =
-            typename call_convention_traits_t::template add_call_convention_t<
-                signature_remove_noexcept_t<
-                    typename call_convention_traits_t::template remove_call_convention_t<Signature>>>;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params...)>
-    {
-        using type = Return(Params...);
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params..., ...)>
-    {
-        using type = Return(Params..., ...);
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params...) noexcept>
-    {
-        using type = Return(Params...);
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params..., ...) noexcept>
-    {
-        using type = Return(Params..., ...);
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params...) const>
-    {
-        using type = Return(Params...) const;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params..., ...) const>
-    {
-        using type = Return(Params..., ...) const;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params...) const noexcept>
-    {
-        using type = Return(Params...) const;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params..., ...) const noexcept>
-    {
-        using type = Return(Params..., ...) const;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params...)&>
-    {
-        using type = Return(Params...) &;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params..., ...)&>
-    {
-        using type = Return(Params..., ...) &;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params...) & noexcept>
-    {
-        using type = Return(Params...) &;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params..., ...) & noexcept>
-    {
-        using type = Return(Params..., ...) &;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params...) const&>
-    {
-        using type = Return(Params...) const&;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params..., ...) const&>
-    {
-        using type = Return(Params..., ...) const&;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params...) const & noexcept>
-    {
-        using type = Return(Params...) const&;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params..., ...) const & noexcept>
-    {
-        using type = Return(Params..., ...) const&;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params...) &&>
-    {
-        using type = Return(Params...) &&;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params..., ...) &&>
-    {
-        using type = Return(Params..., ...) &&;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params...) && noexcept>
-    {
-        using type = Return(Params...) &&;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params..., ...) && noexcept>
-    {
-        using type = Return(Params..., ...) &&;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params...) const&&>
-    {
-        using type = Return(Params...) const&&;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params..., ...) const&&>
-    {
-        using type = Return(Params..., ...) const&&;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params...) const && noexcept>
-    {
-        using type = Return(Params...) const&&;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_noexcept<Return(Params..., ...) const && noexcept>
-    {
-        using type = Return(Params..., ...) const&&;
-    };
-
-    /**
-     * \}
-     */
-
-    /**
-     * \defgroup TYPE_TRAITS_SIGNATURE_REMOVE_REF_QUALIFIER signature_remove_ref_qualifier
-     * \ingroup TYPE_TRAITS
-     * \brief Removes the ref-qualifier of a signature (if present).
-     *
-     *\{
-     */
-
-    template <typename Signature>
-        requires(!has_default_call_convention<Signature>)
-    struct signature_remove_ref_qualifier<Signature>
-    {
-        using call_convention_traits_t = call_convention_traits<signature_call_convention_t<Signature>>;
-        using type =
-            typename call_convention_traits_t::template add_call_convention_t<
-                signature_remove_ref_qualifier_t<
-                    typename call_convention_traits_t::template remove_call_convention_t<Signature>>>;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params...)>
-    {
-        using type = Return(Params...);
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params..., ...)>
-    {
-        using type = Return(Params..., ...);
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params...) noexcept>
-    {
-        using type = Return(Params...) noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params..., ...) noexcept>
-    {
-        using type = Return(Params..., ...) noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params...) const>
-    {
-        using type = Return(Params...) const;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params..., ...) const>
-    {
-        using type = Return(Params..., ...) const;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params...) const noexcept>
-    {
-        using type = Return(Params...) const noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params..., ...) const noexcept>
-    {
-        using type = Return(Params..., ...) const noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params...)&>
-    {
-        using type = Return(Params...);
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params..., ...)&>
-    {
-        using type = Return(Params..., ...);
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params...) & noexcept>
-    {
-        using type = Return(Params...) noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params..., ...) & noexcept>
-    {
-        using type = Return(Params..., ...) noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params...) const&>
-    {
-        using type = Return(Params...) const;
-    };
+     * template <typename Derived, typename Signature>
+     * using call_interface_t = // Interface, which defines ``operator ()`` with the call-convention.
+     * ```
+     *
+     *\{
+     */
 
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params..., ...) const&>
+    /**
+     * \brief Template specialization for the default call-convention.
+     */
+    template <>
+    struct call_convention_traits<detail::default_call_convention>
     {
-        using type = Return(Params..., ...) const;
-    };
+        using tag_t = detail::default_call_convention;
 
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params...) const & noexcept>
-    {
-        using type = Return(Params...) const noexcept;
-    };
+        template <typename Signature>
+        using remove_call_convention_t = std::type_identity_t<Signature>;
 
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params..., ...) const & noexcept>
-    {
-        using type = Return(Params..., ...) const noexcept;
-    };
+        template <typename Signature>
+        using add_call_convention_t = std::type_identity_t<Signature>;
 
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params...) &&>
-    {
-        using type = Return(Params...);
+        template <typename Derived, typename Signature>
+        using call_interface_t = detail::DefaultCallInterface<Derived, Signature>;
     };
 
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params..., ...) &&>
-    {
-        using type = Return(Params..., ...);
-    };
+    /**
+     * \}
+     */
 
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params...) && noexcept>
-    {
-        using type = Return(Params...) noexcept;
-    };
+    /**
+     * \defgroup TYPE_TRAITS_SIGNATURE_ADD_NOEXCEPT signature_add_noexcept
+     * \ingroup TYPE_TRAITS
+     * \brief Adds the ``noexcept`` specification to a signature.
+     *
+     *\{
+     */
 
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params..., ...) && noexcept>
+    template <has_default_call_convention Signature>
+    struct signature_add_noexcept<Signature>
     {
-        using type = Return(Params..., ...) noexcept;
+        using type = typename detail::default_signature_traits<Signature>::add_noexcept_t;
     };
 
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params...) const&&>
-    {
-        using type = Return(Params...) const;
-    };
+    /**
+     * \}
+     */
 
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params..., ...) const&&>
-    {
-        using type = Return(Params..., ...) const;
-    };
+    /**
+     * \defgroup TYPE_TRAITS_SIGNATURE_REMOVE_CALL_CONVENTION signature_remove_call_convention
+     * \ingroup TYPE_TRAITS
+     * \brief Removes the call-convention from a signature (if present).
+     *
+     *\{
+     */
 
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params...) const && noexcept>
+    template <typename Signature>
+    struct signature_remove_call_convention
     {
-        using type = Return(Params...) const noexcept;
+        using type = typename call_convention_traits<
+            signature_call_convention_t<Signature>>::template remove_call_convention_t<Signature>;
     };
 
-    template <typename Return, typename... Params>
-    struct signature_remove_ref_qualifier<Return(Params..., ...) const && noexcept>
+    // Signatures with the default call-convention are returned as-is, even if a call-convention tag has been registered
+    // for the default call-convention.
+    template <has_default_call_convention Signature>
+    struct signature_remove_call_convention<Signature>
     {
-        using type = Return(Params..., ...) const noexcept;
+        using type = Signature;
     };
 
     /**
@@ -768,166 +200,86 @@ namespace mimicpp
      */
 
     /**
-     * \defgroup TYPE_TRAITS_SIGNATURE_REMOVE_CONST_QUALIFIER signature_remove_constqualifier
+     * \defgroup TYPE_TRAITS_SIGNATURE_REMOVE_NOEXCEPT signature_remove_noexcept
      * \ingroup TYPE_TRAITS
-     * \brief Removes the const-qualifier of a signature (if present).
+     * \brief Removes the ``noexcept`` specification from a signature (if present).
      *
      *\{
      */
 
     template <typename Signature>
         requires(!has_default_call_convention<Signature>)
-    struct signature_remove_const_qualifier<Signature>
+    struct signature_remove_noexcept<Signature>
     {
         using call_convention_traits_t = call_convention_traits<signature_call_convention_t<Signature>>;
         using type =
             typename call_convention_traits_t::template add_call_convention_t<
-                signature_remove_const_qualifier_t<
+                signature_remove_noexcept_t<
                     typename call_convention_traits_t::template remove_call_convention_t<Signature>>>;
     };
 
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params...)>
-    {
-        using type = Return(Params...);
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params..., ...)>
-    {
-        using type = Return(Params..., ...);
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params...) noexcept>
-    {
-        using type = Return(Params...) noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params..., ...) noexcept>
-    {
-        using type = Return(Params..., ...) noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params...) const>
-    {
-        using type = Return(Params...);
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params..., ...) const>
-    {
-        using type = Return(Params..., ...);
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params...) const noexcept>
-    {
-        using type = Return(Params...) noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params..., ...) const noexcept>
-    {
-        using type = Return(Params..., ...) noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params...)&>
-    {
-        using type = Return(Params...) &;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params..., ...)&>
-    {
-        using type = Return(Params..., ...) &;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params...) & noexcept>
-    {
-        using type = Return(Params...) & noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params..., ...) & noexcept>
-    {
-        using type = Return(Params..., ...) & noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params...) const&>
-    {
-        using type = Return(Params...) &;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params..., ...) const&>
-    {
-        using type = Return(Params..., ...) &;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params...) const & noexcept>
-    {
-        using type = Return(Params...) & noexcept;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params..., ...) const & noexcept>
+    template <has_default_call_convention Signature>
+    struct signature_remove_noexcept<Signature>
     {
-        using type = Return(Params..., ...) & noexcept;
+        using type = typename detail::default_signature_traits<Signature>::remove_noexcept_t;
     };
 
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params...) &&>
-    {
-        using type = Return(Params...) &&;
-    };
+    /**
+     * \}
+     */
 
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params..., ...) &&>
-    {
-        using type = Return(Params..., ...) &&;
-    };
+    /**
+     * \defgroup TYPE_TRAITS_SIGNATURE_REMOVE_REF_QUALIFIER signature_remove_ref_qualifier
+     * \ingroup TYPE_TRAITS
+     * \brief Removes the ref-qualifier of a signature (if present).
+     *
+     *\{
+     */
 
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params...) && noexcept>
+    template <typename Signature>
+        requires(!has_default_call_convention<Signature>)
+    struct signature_remove_ref_qualifier<Signature>
     {
-        using type = Return(Params...) && noexcept;
+        using call_convention_traits_t = call_convention_traits<signature_call_convention_t<Signature>>;
+        using type =
+            typename call_convention_traits_t::template add_call_convention_t<
+                signature_remove_ref_qualifier_t<
+                    typename call_convention_traits_t::template remove_call_convention_t<Signature>>>;
     };
 
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params..., ...) && noexcept>
+    template <has_default_call_convention Signature>
+    struct signature_remove_ref_qualifier<Signature>
     {
-        using type = Return(Params..., ...) && noexcept;
+        using type = typename detail::default_signature_traits<Signature>::remove_ref_qualifier_t;
     };
 
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params...) const&&>
-    {
-        using type = Return(Params...) &&;
-    };
+    /**
+     * \}
+     */
 
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params..., ...) const&&>
-    {
-        using type = Return(Params..., ...) &&;
-    };
+    /**
+     * \defgroup TYPE_TRAITS_SIGNATURE_REMOVE_CONST_QUALIFIER signature_remove_constqualifier
+     * \ingroup TYPE_TRAITS
+     * \brief Removes the const-qualifier of a signature (if present).
+     *
+     *\{
+     */
 
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params...) const && noexcept>
+    template <typename Signature>
+        requires(!has_default_call_convention<Signature>)
+    struct signature_remove_const_qualifier<Signature>
     {
-        using type = Return(Params...) && noexcept;
+        using call_convention_traits_t = call_convention_traits<signature_call_convention_t<Signature>>;
+        using type =
+            typename call_convention_traits_t::template add_call_convention_t<
+                signature_remove_const_qualifier_t<
+                    typename call_convention_traits_t::template remove_call_convention_t<Signature>>>;
     };
 
-    template <typename Return, typename... Params>
-    struct signature_remove_const_qualifier<Return(Params..., ...) const && noexcept>
+    template <has_default_call_convention Signature>
+    struct signature_remove_const_qualifier<Signature>
     {
-        using type = Return(Params..., ...) && noexcept;
+        using type = typename detail::default_signature_traits<Signature>::remove_const_qualifier_t;
     };
 
     /**
@@ -945,11 +297,13 @@ namespace mimicpp
     template <typename Signature>
     struct signature_decay
     {
-        using type =
-            signature_remove_noexcept_t<
-                signature_remove_ref_qualifier_t<
-                    signature_remove_const_qualifier_t<
-                        signature_remove_call_convention_t<Signature>>>>;
+        using type = signature_decay_t<signature_remove_call_convention_t<Signature>>;
+    };
+
+    template <has_default_call_convention Signature>
+    struct signature_decay<Signature>
+    {
+        using type = typename detail::default_signature_traits<Signature>::decay_t;
     };
 
     /**
@@ -972,16 +326,10 @@ namespace mimicpp
     {
     };
 
-    template <typename Return, typename... Params>
-    struct signature_return_type<Return(Params...)>
-    {
-        using type = Return;
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_return_type<Return(Params..., ...)>
+    template <has_default_call_convention Signature>
+    struct signature_return_type<Signature>
     {
-        using type = Return;
+        using type = typename detail::default_signature_traits<Signature>::return_t;
     };
 
     /**
@@ -1026,11 +374,17 @@ namespace mimicpp
 
     template <typename Signature>
     struct signature_const_qualification
+        /** \cond Help doxygen with recursion.*/
+        : public signature_const_qualification<signature_remove_call_convention_t<Signature>>
+    /** \endcond */
+    {
+    };
+
+    template <has_default_call_convention Signature>
+    struct signature_const_qualification<Signature>
         : public std::integral_constant<
               Constness,
-              std::same_as<Signature, signature_remove_const_qualifier_t<Signature>>
-                  ? Constness::non_const
-                  : Constness::as_const>
+              detail::default_signature_traits<Signature>::constQualification>
     {
     };
 
@@ -1049,59 +403,16 @@ namespace mimicpp
     template <typename Signature>
     struct signature_ref_qualification
         /** \cond Help doxygen with recursion.*/
-        : public signature_ref_qualification<
-              signature_remove_noexcept_t<
-                  signature_remove_const_qualifier_t<
-                      signature_remove_call_convention_t<Signature>>>>
+        : public signature_ref_qualification<signature_remove_call_convention_t<Signature>>
     /** \endcond */
     {
     };
 
-    template <typename Return, typename... Params>
-    struct signature_ref_qualification<Return(Params...)>
-        : public std::integral_constant<
-              ValueCategory,
-              ValueCategory::any>
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_ref_qualification<Return(Params..., ...)>
-        : public std::integral_constant<
-              ValueCategory,
-              ValueCategory::any>
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_ref_qualification<Return(Params...)&>
-        : public std::integral_constant<
-              ValueCategory,
-              ValueCategory::lvalue>
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_ref_qualification<Return(Params..., ...)&>
-        : public std::integral_constant<
-              ValueCategory,
-              ValueCategory::lvalue>
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_ref_qualification<Return(Params...) &&>
-        : public std::integral_constant<
-              ValueCategory,
-              ValueCategory::rvalue>
-    {
-    };
-
-    template <typename Return, typename... Params>
-    struct signature_ref_qualification<Return(Params..., ...) &&>
+    template <has_default_call_convention Signature>
+    struct signature_ref_qualification<Signature>
         : public std::integral_constant<
               ValueCategory,
-              ValueCategory::rvalue>
+              detail::default_signature_traits<Signature>::refQualification>
     {
     };
 
@@ -1119,8 +430,17 @@ namespace mimicpp
 
     template <typename Signature>
     struct signature_is_noexcept
-        : public std::bool_constant<
-              !std::same_as<Signature, signature_remove_noexcept_t<Signature>>>
+        /** \cond Help doxygen with recursion.*/
+        : public signature_is_noexcept<signature_remove_call_convention_t<Signature>>
+    /** \endcond */
+    {
+    };
+
+    template <has_default_call_convention Signature>
+    struct signature_is_noexcept<Signature>
+        : public std::integral_constant<
+              bool,
+              detail::default_signature_traits<Signature>::isNoexcept>
     {
     };
 
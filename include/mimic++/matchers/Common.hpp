@@ -101,6 +101,23 @@ namespace mimicpp::detail::describe_hook
     };
 }
 
+namespace mimicpp::detail
+{
+    /**
+     * \brief Determines, whether the description of the given matcher solely depends on the matcher itself.
+     * \details Such descriptions never change and can thus be built once and then be reused.
+     * Matchers, which refer to data of the user (e.g. range matchers, which observe an lvalue container), must not be
+     * treated as stable, as their descriptions must reflect the current state of that data.
+     * By default, just matchers with a static ``describe`` function are considered stable.
+     */
+    template <typename Matcher>
+    struct has_stable_description
+        : public std::bool_constant<
+              requires { { Matcher::describe() } -> std::convertible_to<StringViewT>; }>
+    {
+    };
+}
+
 namespace mimicpp
 {
     template <typename T, typename First, typename... Others>
@@ -12,11 +12,18 @@
 #include "mimic++/matchers/GeneralMatchers.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <limits>
+#include <ranges>
 #include <stdexcept>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace mimicpp::matches
 {
@@ -156,4 +163,288 @@ namespace mimicpp::matches
      */
 }
 
+namespace mimicpp::matches::detail
+{
+    template <typename Range>
+    concept floating_point_span = std::ranges::contiguous_range<Range>
+                               && std::ranges::sized_range<Range>
+                               && std::floating_point<std::ranges::range_value_t<Range>>;
+
+    /**
+     * \brief Applies the predicate on each element pair of two equally sized arrays.
+     * \details The elements are inspected in blocks without early-exits, which lets the compiler vectorize the inner loop.
+     */
+    template <std::floating_point Float, typename Predicate>
+    [[nodiscard]]
+    constexpr bool all_elements_within(
+        const Float* const target,
+        const Float* const expected,
+        const std::size_t length,
+        const Predicate& predicate) noexcept
+    {
+        constexpr std::size_t blockSize{64u};
+
+        std::size_t i{0u};
+        for (; i + blockSize <= length; i += blockSize)
+        {
+            unsigned mismatches{0u};
+            for (std::size_t j{0u}; j < blockSize; ++j)
+            {
+                mismatches |= static_cast<unsigned>(!predicate(target[i + j], expected[i + j]));
+            }
+
+            if (0u != mismatches)
+            {
+                return false;
+            }
+        }
+
+        for (; i < length; ++i)
+        {
+            if (!predicate(target[i], expected[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename Target, typename Expected, typename Predicate>
+    [[nodiscard]]
+    constexpr bool approx_elements(Target& target, Expected& expected, const Predicate& predicate) noexcept
+    {
+        const std::size_t length = std::ranges::size(expected);
+        return std::cmp_equal(length, std::ranges::size(target))
+            && detail::all_elements_within(
+                   std::ranges::data(target),
+                   std::ranges::data(expected),
+                   length,
+                   predicate);
+    }
+
+    template <std::floating_point Float>
+    struct abs_within
+    {
+        Float epsilon;
+
+        [[nodiscard]]
+        constexpr bool operator()(const Float target, const Float expected) const noexcept
+        {
+            // NaN and infinity lead to a NaN difference, which never compares less or equal
+            return std::abs(target - expected) <= epsilon;
+        }
+    };
+
+    template <std::floating_point Float>
+    struct rel_within
+    {
+        Float relEpsilon;
+
+        [[nodiscard]]
+        constexpr bool operator()(const Float target, const Float expected) const noexcept
+        {
+            // An infinite operand would lead to an infinite epsilon, which would accept any difference.
+            // Clamping the epsilon to the largest finite value rejects all infinite differences instead, which occur
+            // whenever at least one operand is infinite (or NaN, when both are).
+            // This is intentionally expressed without any branch, as that would prevent the vectorization.
+            const Float scaledEpsilon = std::min(
+                relEpsilon * std::max(std::abs(target), std::abs(expected)),
+                std::numeric_limits<Float>::max());
+            return std::abs(target - expected) <= scaledEpsilon;
+        }
+    };
+
+    template <std::floating_point Float>
+        requires std::numeric_limits<Float>::is_iec559
+              && (sizeof(Float) == sizeof(std::uint32_t) || sizeof(Float) == sizeof(std::uint64_t))
+    struct ulp_within
+    {
+        using UnsignedT = std::conditional_t<sizeof(Float) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+        using SignedT = std::make_signed_t<UnsignedT>;
+
+        UnsignedT maxUlps;
+
+        /**
+         * \brief Determines the distance of both values in ULPs and compares it to the limit.
+         * \details Values of equal sign are apart by the difference of their magnitudes, otherwise by their sum (which
+         * also maps ``-0`` and ``+0`` onto the same value).
+         * Neither can overflow, as the magnitude of non-NaN values is at most the one of infinity, which is less than
+         * half of the unsigned range.
+         * Everything is expressed branch-free via masks and on the magnitudes only, which keeps the vectorized loop
+         * short even without SSE4 min/max and blend instructions.
+         */
+        [[nodiscard]]
+        constexpr bool operator()(const Float target, const Float expected) const noexcept
+        {
+            constexpr std::size_t signShift = 8u * sizeof(UnsignedT) - 1u;
+            constexpr UnsignedT signBit = UnsignedT{1u} << signShift;
+            constexpr auto infinityMagnitude = std::bit_cast<SignedT>(std::numeric_limits<Float>::infinity());
+
+            const auto targetBits = std::bit_cast<UnsignedT>(target);
+            const auto expectedBits = std::bit_cast<UnsignedT>(expected);
+            const UnsignedT targetMagnitude = targetBits & ~signBit;
+            const UnsignedT expectedMagnitude = expectedBits & ~signBit;
+
+            // the magnitudes fit into the signed type, thus the difference does, too
+            const auto difference = static_cast<SignedT>(targetMagnitude - expectedMagnitude);
+            const SignedT negativeMask = difference >> signShift;
+            const auto absDifference = static_cast<UnsignedT>((difference ^ negativeMask) - negativeMask);
+            const UnsignedT sum = targetMagnitude + expectedMagnitude;
+
+            // either all or no bits set
+            const UnsignedT oppositeSignMask = UnsignedT{0u} - ((targetBits ^ expectedBits) >> signShift);
+            const UnsignedT distance = (sum & oppositeSignMask) | (absDifference & ~oppositeSignMask);
+
+            // NaN has a greater magnitude than infinity
+            return (static_cast<SignedT>(targetMagnitude) <= infinityMagnitude)
+                 & (static_cast<SignedT>(expectedMagnitude) <= infinityMagnitude)
+                 & (distance <= maxUlps);
+        }
+    };
+
+    template <typename Predicate, typename Range, typename Tolerance>
+    [[nodiscard]]
+    constexpr auto make_approx_range_matcher(
+        Range&& expected,
+        const Tolerance tolerance,
+        const StringViewT fmt,
+        const StringViewT invertedFmt)
+    {
+        using FloatT = std::ranges::range_value_t<Range>;
+
+        return PredicateMatcher{
+            []<floating_point_span Target>(Target&& target, auto& range, const Tolerance tol) // NOLINT(cppcoreguidelines-missing-std-forward)
+                requires std::same_as<FloatT, std::ranges::range_value_t<Target>>
+            {
+                return detail::approx_elements(target, range, Predicate{tol});
+            },
+            fmt,
+            invertedFmt,
+            std::make_tuple(
+                std::views::all(std::forward<Range>(expected)),
+                tolerance)};
+    }
+}
+
+namespace mimicpp::matches::range
+{
+    /**
+     * \addtogroup MATCHERS_RANGE
+     *
+     *\{
+     */
+
+    /**
+     * \brief Tests, whether each element of the floating-point target range is approximately equal to the corresponding
+     * element of the expected range.
+     * \tparam Range Expected range type.
+     * \param expected The expected range.
+     * \param epsilon The maximum absolute difference.
+     * \throws std::runtime_error When ``epsilon`` is ``NaN``, ``infinity`` or non-positive.
+     * \return The newly created matcher.
+     *
+     * \details Both ranges must be contiguous and share the same floating-point type.
+     * The elements are compared in vectorizable blocks, which is significantly faster than combining ``each_element``
+     * with the scalar ``approx_abs``.
+     * Non-finite elements never match.
+     * \see matches::approx_abs
+     */
+    template <detail::floating_point_span Range>
+    [[nodiscard]]
+    constexpr auto approx_abs(Range&& expected, const std::ranges::range_value_t<Range> epsilon)
+    {
+        using FloatT = std::ranges::range_value_t<Range>;
+        detail::check_fp_epsilon(epsilon);
+
+        return detail::make_approx_range_matcher<detail::abs_within<FloatT>>(
+            std::forward<Range>(expected),
+            epsilon,
+            "elements are approximately {} +- {}",
+            "elements are not approximately {} +- {}");
+    }
+
+    /**
+     * \brief Tests, whether each element of the floating-point target range is approximately equal to the corresponding
+     * element of the expected range.
+     * \tparam Range Expected range type.
+     * \param expected The expected range.
+     * \param relEpsilon The maximum relative difference.
+     * \throws std::runtime_error When ``relEpsilon`` is ``NaN``, ``infinity`` or non-positive.
+     * \return The newly created matcher.
+     *
+     * \details Both ranges must be contiguous and share the same floating-point type.
+     * The elements are compared with the same algorithm as the scalar ``approx_rel``, but in vectorizable blocks.
+     * Elements, which are ``NaN`` or ``infinity`` in either range, never match.
+     * \see matches::approx_rel(std::floating_point auto, std::floating_point auto)
+     */
+    template <detail::floating_point_span Range>
+    [[nodiscard]]
+    constexpr auto approx_rel(Range&& expected, const std::ranges::range_value_t<Range> relEpsilon)
+    {
+        using FloatT = std::ranges::range_value_t<Range>;
+        detail::check_fp_epsilon(relEpsilon);
+
+        return detail::make_approx_range_matcher<detail::rel_within<FloatT>>(
+            std::forward<Range>(expected),
+            relEpsilon,
+            "elements are approximately {} +- ({} * max(|lhs|, |rhs|))",
+            "elements are not approximately {} +- ({} * max(|lhs|, |rhs|))");
+    }
+
+    /**
+     * \brief Tests, whether each element of the floating-point target range is approximately equal to the corresponding
+     * element of the expected range.
+     * \tparam Range Expected range type.
+     * \param expected The expected range.
+     * \return The newly created matcher.
+     *
+     * \details This overload sets ``100 * std::numeric_limits<Float>::epsilon()`` as the relative epsilon value.
+     * \see matches::approx_rel(std::floating_point auto)
+     */
+    template <detail::floating_point_span Range>
+    [[nodiscard]]
+    constexpr auto approx_rel(Range&& expected)
+    {
+        using FloatT = std::ranges::range_value_t<Range>;
+
+        return range::approx_rel(
+            std::forward<Range>(expected),
+            std::numeric_limits<FloatT>::epsilon() * FloatT{100});
+    }
+
+    /**
+     * \brief Tests, whether each element of the floating-point target range is at most ``maxUlps`` representable values
+     * apart from the corresponding element of the expected range.
+     * \tparam Range Expected range type.
+     * \param expected The expected range.
+     * \param maxUlps The maximum distance in units in the last place (ULP).
+     * \return The newly created matcher.
+     *
+     * \details Both ranges must be contiguous and share the same floating-point type, which must be an
+     * IEEE-754 ``float`` or ``double``.
+     * In contrast to the epsilon based matchers, the tolerance scales with the magnitude of the elements.
+     * ``-0`` and ``+0`` are considered equal and ``NaN`` never matches.
+     * \note The comparison requires integer arithmetic on the representations. That's significantly more work per element
+     * than ``approx_abs`` and ``approx_rel``, thus this matcher is just about as fast as ``eq`` with a custom comparator.
+     */
+    template <detail::floating_point_span Range>
+        requires requires { typename detail::ulp_within<std::ranges::range_value_t<Range>>::UnsignedT; }
+    [[nodiscard]]
+    constexpr auto approx_ulp(Range&& expected, const std::uint32_t maxUlps)
+    {
+        using PredicateT = detail::ulp_within<std::ranges::range_value_t<Range>>;
+
+        return detail::make_approx_range_matcher<PredicateT>(
+            std::forward<Range>(expected),
+            typename PredicateT::UnsignedT{maxUlps},
+            "elements are approximately {} within {} ULPs",
+            "elements are not approximately {} within {} ULPs");
+    }
+
+    /**
+     * \}
+     */
+}
+
 #endif
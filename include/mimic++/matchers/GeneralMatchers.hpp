@@ -12,6 +12,7 @@
 #include "mimic++/matchers/Common.hpp"
 
 #include <functional>
+#include <ranges>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -35,6 +36,21 @@ namespace mimicpp::detail
         {
             return std::invoke(DescribeProjection{}, arg);
         }
+
+        /**
+         * \brief Prints the stored arg through the given cache, which must own this storage.
+         */
+        decltype(auto) as_describe_arg(PrintCache& cache) const
+        {
+            if constexpr (std::same_as<PrintFn, DescribeProjection>)
+            {
+                return cache.print(arg);
+            }
+            else
+            {
+                return as_describe_arg();
+            }
+        }
     };
 
     template <typename T>
@@ -51,6 +67,35 @@ namespace mimicpp::detail
 
     template <typename T>
     using to_arg_storage_t = typename to_arg_storage<T>::type;
+
+    /**
+     * \brief Determines, whether the printed form of a stored matcher argument solely depends on the argument itself.
+     * \details Pointers, references and borrowed ranges (e.g. ``std::ranges::ref_view`` or ``std::string_view``) refer
+     * to external data, which may change at any time.
+     * Unknown types are conservatively treated as unstable.
+     */
+    template <typename T>
+    struct is_stable_description_arg
+        : public std::bool_constant<
+              std::is_arithmetic_v<T>
+              || std::is_enum_v<T>
+              || std::is_null_pointer_v<T>>
+    {
+    };
+
+    template <typename T>
+        requires std::ranges::range<T>
+              && (!std::ranges::borrowed_range<T>)
+    struct is_stable_description_arg<T>
+        : public is_stable_description_arg<std::remove_cvref_t<std::ranges::range_value_t<T>>>
+    {
+    };
+
+    template <typename Arg, typename MatchesProjection, typename DescribeProjection>
+    struct is_stable_description_arg<arg_storage<Arg, MatchesProjection, DescribeProjection>>
+        : public is_stable_description_arg<Arg>
+    {
+    };
 }
 
 namespace mimicpp
@@ -119,15 +164,21 @@ namespace mimicpp
         [[nodiscard]]
         constexpr StringT describe() const
         {
+            // Only owned matchers are kept alive and unchanged during the whole report creation,
+            // thus just their args are safe to cache.
+            if (detail::PrintCache* const cache = detail::PrintCacheScope::current();
+                cache && cache->owns(*this))
+            {
+                return std::apply(
+                    [&, this](auto&... additionalArgs) {
+                        return format_description(additionalArgs.as_describe_arg(*cache)...);
+                    },
+                    m_AdditionalArgs);
+            }
+
             return std::apply(
-                [&, this](auto&... additionalArgs) {
-                    return format::vformat(
-                        m_FormatString,
-                        format::make_format_args(
-                            std::invoke(
-                                // std::make_format_args requires lvalue-refs, so let's transform rvalue-refs to const lvalue-refs
-                                [](auto&& val) noexcept -> const auto& { return val; },
-                                additionalArgs.as_describe_arg())...));
+                [this](auto&... additionalArgs) {
+                    return format_description(additionalArgs.as_describe_arg()...);
                 },
                 m_AdditionalArgs);
         }
@@ -160,6 +211,16 @@ namespace mimicpp
         StringViewT m_InvertedFormatString;
         storage_t m_AdditionalArgs;
 
+        template <typename... Args>
+        [[nodiscard]]
+        StringT format_description(Args&&... args) const
+        {
+            // std::make_format_args requires lvalue-refs, which the named params already are
+            return format::vformat(
+                m_FormatString,
+                format::make_format_args(args...));
+        }
+
         template <typename Fn>
         [[nodiscard]]
         static constexpr auto make_inverted(
@@ -176,7 +237,19 @@ namespace mimicpp
                 std::move(tuple)};
         }
     };
+}
 
+namespace mimicpp::detail
+{
+    template <typename Predicate, typename... AdditionalArgs>
+    struct has_stable_description<PredicateMatcher<Predicate, AdditionalArgs...>>
+        : public std::bool_constant<(... && is_stable_description_arg<AdditionalArgs>::value)>
+    {
+    };
+}
+
+namespace mimicpp
+{
     /**
      * \brief Matcher, which never fails.
      * \ingroup MATCHERS
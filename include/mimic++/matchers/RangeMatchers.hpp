@@ -12,10 +12,338 @@
 
 #include <algorithm>
 #include <concepts>
+#include <cstddef>
 #include <functional>
+#include <iterator>
 #include <ranges>
 #include <tuple>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
+
+#ifdef MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS
+    #include <execution>
+#endif
+
+namespace mimicpp::matches::range::unordered_strategy
+{
+    /**
+     * \brief Strategy tag, which lets ``unordered_eq`` compare the elements pairwise.
+     * \details This has quadratic complexity in the worst-case, but has no further requirements on the element-type.
+     * \ingroup MATCHERS_RANGE
+     */
+    struct pairwise_t
+    {
+    } constexpr pairwise{};
+
+    /**
+     * \brief Strategy tag, which lets ``unordered_eq`` count the expected elements in a hash-table.
+     * \details This has linear complexity, but requires the element-type to be hashable via ``std::hash``.
+     * \ingroup MATCHERS_RANGE
+     */
+    struct hashed_t
+    {
+    } constexpr hashed{};
+
+    /**
+     * \brief Strategy tag, which lets ``unordered_eq`` sort copies of both ranges and then compare them.
+     * \details This has linearithmic complexity, but requires the element-type to be copyable and totally ordered.
+     * \ingroup MATCHERS_RANGE
+     */
+    struct sorted_t
+    {
+    } constexpr sorted{};
+}
+
+namespace mimicpp::matches::detail
+{
+    template <typename T>
+    concept hashable = std::equality_comparable<T>
+                    && requires(const T& value) {
+                           { std::hash<T>{}(value) } -> std::convertible_to<std::size_t>;
+                       };
+
+    template <typename Target, typename Expected>
+    concept same_range_value_types = std::same_as<
+        std::ranges::range_value_t<Target>,
+        std::ranges::range_value_t<Expected>>;
+
+    template <typename Target, typename Expected>
+    concept hash_permutable_ranges = std::ranges::forward_range<Target>
+                                  && std::ranges::forward_range<Expected>
+                                  && same_range_value_types<Target, Expected>
+                                  && hashable<std::ranges::range_value_t<Expected>>
+                                  && std::copy_constructible<std::ranges::range_value_t<Expected>>;
+
+    template <typename Target, typename Expected>
+    concept sort_permutable_ranges = std::ranges::forward_range<Target>
+                                  && std::ranges::forward_range<Expected>
+                                  && same_range_value_types<Target, Expected>
+                                  && std::totally_ordered<std::ranges::range_value_t<Expected>>
+                                  && std::sortable<typename std::vector<std::ranges::range_value_t<Expected>>::iterator>;
+
+    template <typename T>
+    concept execution_policy =
+#ifdef MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS
+        std::is_execution_policy_v<std::remove_cvref_t<T>>;
+#else
+        false;
+#endif
+
+    template <typename Comparator>
+    concept default_equality = std::same_as<Comparator, std::equal_to<>>
+                            || std::same_as<Comparator, std::ranges::equal_to>;
+
+    template <typename T>
+    struct element_hash
+    {
+        // Also accepts std::reference_wrapper<const T>, due to its implicit conversion.
+        [[nodiscard]]
+        std::size_t operator()(const T& value) const
+        {
+            return std::hash<T>{}(value);
+        }
+    };
+
+    template <typename T>
+    struct element_equal
+    {
+        [[nodiscard]]
+        bool operator()(const T& lhs, const T& rhs) const
+        {
+            return lhs == rhs;
+        }
+    };
+
+    template <typename Target, typename Expected>
+    [[nodiscard]]
+    constexpr bool have_same_size(Target& target, Expected& expected)
+    {
+        if constexpr (std::ranges::sized_range<Target> && std::ranges::sized_range<Expected>)
+        {
+            return std::cmp_equal(std::ranges::size(target), std::ranges::size(expected));
+        }
+        else
+        {
+            return std::ranges::distance(target) == std::ranges::distance(expected);
+        }
+    }
+
+    /**
+     * \brief Counts the expected elements in a hash-table and then consumes them by the target elements.
+     * \details The table refers to the expected elements, if the expected range yields lvalue-references.
+     * Otherwise, the elements are copied into the table.
+     */
+    template <typename Target, typename Expected>
+        requires hash_permutable_ranges<Target, Expected>
+    [[nodiscard]]
+    bool is_hashed_permutation(Target& target, Expected& expected)
+    {
+        if (!detail::have_same_size(target, expected))
+        {
+            return false;
+        }
+
+        using ValueT = std::ranges::range_value_t<Expected>;
+        using KeyT = std::conditional_t<
+            std::is_lvalue_reference_v<std::ranges::range_reference_t<Expected>>,
+            std::reference_wrapper<const ValueT>,
+            ValueT>;
+
+        std::unordered_map<KeyT, std::ptrdiff_t, element_hash<ValueT>, element_equal<ValueT>> counts{};
+        if constexpr (std::ranges::sized_range<Expected>)
+        {
+            counts.reserve(std::ranges::size(expected));
+        }
+
+        for (const ValueT& element : expected)
+        {
+            ++counts[KeyT{element}];
+        }
+
+        for (const ValueT& element : target)
+        {
+            const auto iter = counts.find(KeyT{element});
+            if (iter == counts.cend()
+                || 0 == iter->second--)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <std::ranges::forward_range Range>
+    [[nodiscard]]
+    auto to_sorted_vector(Range& range)
+    {
+        std::vector<std::ranges::range_value_t<Range>> elements{};
+        if constexpr (std::ranges::sized_range<Range>)
+        {
+            elements.reserve(std::ranges::size(range));
+        }
+
+        std::ranges::copy(range, std::back_inserter(elements));
+        std::ranges::sort(elements);
+
+        return elements;
+    }
+
+    template <typename Target, typename Expected>
+        requires sort_permutable_ranges<Target, Expected>
+    [[nodiscard]]
+    bool is_sorted_permutation(Target& target, Expected& expected)
+    {
+        return detail::have_same_size(target, expected)
+            && detail::to_sorted_vector(target) == detail::to_sorted_vector(expected);
+    }
+
+    /**
+     * \brief Selects the cheapest applicable strategy, when the elements are compared via ``operator ==``.
+     * \details Hashing is preferred over sorting; the pairwise comparison is the fallback for all other cases.
+     */
+    template <typename Target, typename Expected, typename Comparator>
+    [[nodiscard]]
+    constexpr bool is_permutation(Target& target, Expected& expected, const Comparator& comparator)
+    {
+        if constexpr (default_equality<Comparator>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                if constexpr (hash_permutable_ranges<Target, Expected>)
+                {
+                    return detail::is_hashed_permutation(target, expected);
+                }
+                else if constexpr (sort_permutable_ranges<Target, Expected>)
+                {
+                    return detail::is_sorted_permutation(target, expected);
+                }
+            }
+        }
+
+        return std::ranges::is_permutation(
+            target,
+            expected,
+            std::ref(comparator));
+    }
+
+    template <typename Strategy>
+    [[nodiscard]]
+    constexpr auto make_unordered_eq_matcher(auto&& expected)
+    {
+        return PredicateMatcher{
+            []<typename Target>(Target&& target, auto& range) // NOLINT(cppcoreguidelines-missing-std-forward)
+                requires(std::same_as<Strategy, range::unordered_strategy::hashed_t>
+                         && hash_permutable_ranges<Target&, decltype(range)>)
+                     || (std::same_as<Strategy, range::unordered_strategy::sorted_t>
+                         && sort_permutable_ranges<Target&, decltype(range)>)
+                     || (std::same_as<Strategy, range::unordered_strategy::pairwise_t>
+                         && std::predicate<
+                             const std::equal_to<>&,
+                             std::ranges::range_reference_t<Target>,
+                             std::ranges::range_reference_t<decltype(range)>>)
+            {
+                if constexpr (std::same_as<Strategy, range::unordered_strategy::hashed_t>)
+                {
+                    return detail::is_hashed_permutation(target, range);
+                }
+                else if constexpr (std::same_as<Strategy, range::unordered_strategy::sorted_t>)
+                {
+                    return detail::is_sorted_permutation(target, range);
+                }
+                else
+                {
+                    return std::ranges::is_permutation(target, range);
+                }
+            },
+            "is a permutation of {}",
+            "is not a permutation of {}",
+            std::make_tuple(std::views::all(std::forward<decltype(expected)>(expected)))};
+    }
+}
+
+#ifdef MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS
+
+namespace mimicpp::matches::detail
+{
+    /**
+     * \brief Ranges with less elements are always inspected sequentially, as the overhead of the parallel algorithms
+     * would outweigh their benefit.
+     */
+    inline constexpr std::size_t parallelThreshold{1u << 14u};
+
+    /**
+     * \brief Determines, whether the parallel algorithms can split the given range.
+     * \details The parallel algorithms still rely on the legacy iterator-categories, thus e.g. ``std::views::iota`` is
+     * not considered.
+     */
+    template <typename Range>
+    concept parallel_range = std::ranges::random_access_range<Range>
+                          && std::ranges::sized_range<Range>
+                          && std::ranges::common_range<Range>
+                          && std::derived_from<
+                                 typename std::iterator_traits<std::ranges::iterator_t<Range>>::iterator_category,
+                                 std::random_access_iterator_tag>;
+
+    template <typename Range>
+    [[nodiscard]]
+    constexpr bool is_parallelizable(Range& range)
+    {
+        if constexpr (parallel_range<Range&>)
+        {
+            return parallelThreshold <= std::ranges::size(range);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    struct describe_execution_policy_fn
+    {
+        template <typename Policy>
+        [[nodiscard]]
+        constexpr StringViewT operator()([[maybe_unused]] const Policy& policy) const noexcept
+        {
+            if constexpr (std::same_as<std::execution::sequenced_policy, Policy>)
+            {
+                return "sequenced";
+            }
+            else if constexpr (std::same_as<std::execution::parallel_policy, Policy>)
+            {
+                return "parallel";
+            }
+            else if constexpr (std::same_as<std::execution::parallel_unsequenced_policy, Policy>)
+            {
+                return "parallel unsequenced";
+            }
+    #if 201902L <= __cpp_lib_execution
+            else if constexpr (std::same_as<std::execution::unsequenced_policy, Policy>)
+            {
+                return "unsequenced";
+            }
+    #endif
+            else
+            {
+                return "implementation-defined";
+            }
+        }
+    };
+
+    template <typename Policy>
+    [[nodiscard]]
+    constexpr auto make_policy_storage(Policy&& policy)
+    {
+        return mimicpp::detail::arg_storage<
+            std::remove_cvref_t<Policy>,
+            std::identity,
+            describe_execution_policy_fn>{std::forward<Policy>(policy)};
+    }
+}
+
+#endif
 
 namespace mimicpp::matches::range
 {
@@ -23,6 +351,9 @@ namespace mimicpp::matches::range
      * \defgroup MATCHERS_RANGE range matchers
      * \ingroup MATCHERS
      * \brief Range specific matchers.
+     * \details If \ref MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS is enabled, ``eq``, ``is_sorted``, ``each_element`` and
+     * ``any_element`` additionally accept an execution policy (e.g. ``std::execution::par_unseq``) as first argument,
+     * which is then applied on large random-access ranges.
      * \snippet Requirements.cpp matcher range
      *\{
      */
@@ -61,6 +392,10 @@ namespace mimicpp::matches::range
      * \tparam Comparator Comparator type.
      * \param expected The expected range.
      * \param comparator The comparator.
+     * \details If the elements are compared via ``operator ==`` (the default) and both ranges share the same element-type,
+     * the cheapest applicable strategy is selected: hashable elements are counted in a hash-table, totally ordered elements
+     * are compared as sorted copies, and all other elements are compared pairwise.
+     * Custom comparators always lead to a pairwise comparison.
      */
     template <std::ranges::forward_range Range, typename Comparator = std::equal_to<>>
     [[nodiscard]]
@@ -73,22 +408,58 @@ namespace mimicpp::matches::range
                              std::ranges::range_reference_t<Target>,
                              std::ranges::range_reference_t<Range>>
             {
-                return std::ranges::is_permutation(
-                    target,
-                    range,
-                    std::ref(comp));
+                return detail::is_permutation(target, range, comp);
             },
             "is a permutation of {}",
             "is not a permutation of {}",
             std::make_tuple(std::views::all(std::forward<Range>(expected)))};
     }
 
+    /**
+     * \brief Tests, whether the target range is a permutation of the expected range, by counting the elements in a hash-table.
+     * \tparam Range Expected range type.
+     * \param expected The expected range.
+     * \details Both ranges must have the same element-type.
+     */
+    template <std::ranges::forward_range Range>
+    [[nodiscard]]
+    constexpr auto unordered_eq(Range&& expected, [[maybe_unused]] const unordered_strategy::hashed_t strategy)
+    {
+        return detail::make_unordered_eq_matcher<unordered_strategy::hashed_t>(std::forward<Range>(expected));
+    }
+
+    /**
+     * \brief Tests, whether the target range is a permutation of the expected range, by comparing sorted copies of them.
+     * \tparam Range Expected range type.
+     * \param expected The expected range.
+     * \details Both ranges must have the same element-type.
+     */
+    template <std::ranges::forward_range Range>
+    [[nodiscard]]
+    constexpr auto unordered_eq(Range&& expected, [[maybe_unused]] const unordered_strategy::sorted_t strategy)
+    {
+        return detail::make_unordered_eq_matcher<unordered_strategy::sorted_t>(std::forward<Range>(expected));
+    }
+
+    /**
+     * \brief Tests, whether the target range is a permutation of the expected range, by comparing the elements pairwise.
+     * \tparam Range Expected range type.
+     * \param expected The expected range.
+     */
+    template <std::ranges::forward_range Range>
+    [[nodiscard]]
+    constexpr auto unordered_eq(Range&& expected, [[maybe_unused]] const unordered_strategy::pairwise_t strategy)
+    {
+        return detail::make_unordered_eq_matcher<unordered_strategy::pairwise_t>(std::forward<Range>(expected));
+    }
+
     /**
      * \brief Tests, whether the target range is sorted, by applying the relation on each adjacent elements.
      * \tparam Relation Relation type.
      * \param relation The relation.
      */
     template <typename Relation = std::ranges::less>
+        requires(!detail::execution_policy<Relation>)
     [[nodiscard]]
     constexpr auto is_sorted(Relation relation = Relation{})
     {
@@ -189,6 +560,179 @@ namespace mimicpp::matches::range
                     std::forward<MatcherT>(matcher)})};
     }
 
+#ifdef MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS
+
+    /**
+     * \brief Tests, whether the target range compares equal to the expected range, by comparing them element-wise
+     * with the given execution policy.
+     * \tparam Policy Execution policy type.
+     * \tparam Range Expected range type.
+     * \tparam Comparator Comparator type.
+     * \param policy The execution policy.
+     * \param expected The expected range.
+     * \param comparator The comparator.
+     * \details The policy is just applied, if both ranges are random-access and have at least
+     * \ref detail::parallelThreshold elements. Otherwise, they are compared sequentially.
+     * \note Requires \ref MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS.
+     */
+    template <detail::execution_policy Policy, std::ranges::forward_range Range, typename Comparator = std::equal_to<>>
+    [[nodiscard]]
+    constexpr auto eq(Policy&& policy, Range&& expected, Comparator comparator = Comparator{})
+    {
+        return PredicateMatcher{
+            [comp = std::move(comparator)]<typename Target>(Target&& target, auto& range, const auto& pol) // NOLINT(cppcoreguidelines-missing-std-forward)
+                requires std::predicate<
+                             const Comparator&,
+                             std::ranges::range_reference_t<Target>,
+                             std::ranges::range_reference_t<Range>>
+            {
+                if constexpr (detail::parallel_range<Target&> && detail::parallel_range<decltype(range)>)
+                {
+                    if (detail::is_parallelizable(target) && detail::is_parallelizable(range))
+                    {
+                        return std::equal(
+                            pol,
+                            std::ranges::begin(target),
+                            std::ranges::end(target),
+                            std::ranges::begin(range),
+                            std::ranges::end(range),
+                            std::ref(comp));
+                    }
+                }
+
+                return std::ranges::equal(
+                    target,
+                    range,
+                    std::ref(comp));
+            },
+            "elements are {} ({} execution)",
+            "elements are not {} ({} execution)",
+            std::make_tuple(
+                std::views::all(std::forward<Range>(expected)),
+                detail::make_policy_storage(std::forward<Policy>(policy)))};
+    }
+
+    /**
+     * \brief Tests, whether the target range is sorted, by applying the relation on each adjacent elements with the
+     * given execution policy.
+     * \tparam Policy Execution policy type.
+     * \tparam Relation Relation type.
+     * \param policy The execution policy.
+     * \param relation The relation.
+     * \details The policy is just applied, if the target is random-access and has at least \ref detail::parallelThreshold
+     * elements. Otherwise, it's inspected sequentially.
+     * \note Requires \ref MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS.
+     */
+    template <detail::execution_policy Policy, typename Relation = std::ranges::less>
+    [[nodiscard]]
+    constexpr auto is_sorted(Policy&& policy, Relation relation = Relation{})
+    {
+        return PredicateMatcher{
+            [rel = std::move(relation)]<typename Target>(Target&& target, const auto& pol) // NOLINT(cppcoreguidelines-missing-std-forward)
+                requires std::equivalence_relation<
+                             const Relation&,
+                             std::ranges::range_reference_t<Target>,
+                             std::ranges::range_reference_t<Target>>
+            {
+                if constexpr (detail::parallel_range<Target&>)
+                {
+                    if (detail::is_parallelizable(target))
+                    {
+                        return std::is_sorted(
+                            pol,
+                            std::ranges::begin(target),
+                            std::ranges::end(target),
+                            std::ref(rel));
+                    }
+                }
+
+                return std::ranges::is_sorted(
+                    target,
+                    std::ref(rel));
+            },
+            "is a sorted range ({} execution)",
+            "is an unsorted range ({} execution)",
+            std::make_tuple(detail::make_policy_storage(std::forward<Policy>(policy)))};
+    }
+
+    /**
+     * \brief Tests, whether each element of the target range matches the specified matcher with the given execution policy.
+     * \param policy The execution policy.
+     * \param matcher The matcher.
+     * \details The policy is just applied, if the target is random-access and has at least \ref detail::parallelThreshold
+     * elements. Otherwise, it's inspected sequentially.
+     * \attention The matcher may be invoked concurrently, thus it must be safe to do so.
+     * \note Requires \ref MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS.
+     */
+    template <detail::execution_policy Policy, typename Matcher>
+    [[nodiscard]]
+    constexpr auto each_element(Policy&& policy, Matcher&& matcher)
+    {
+        using MatcherT = std::remove_cvref_t<Matcher>;
+        return PredicateMatcher{
+            []<std::ranges::range Target>(Target&& target, const MatcherT& m, const auto& pol) { // NOLINT(cppcoreguidelines-missing-std-forward)
+                auto matches = [&](const auto& element) { return m.matches(element); };
+                if constexpr (detail::parallel_range<Target&>)
+                {
+                    if (detail::is_parallelizable(target))
+                    {
+                        return std::all_of(pol, std::ranges::begin(target), std::ranges::end(target), matches);
+                    }
+                }
+
+                return std::ranges::all_of(target, matches);
+            },
+            "each el in range: el {} ({} execution)",
+            "not each el in range: el {} ({} execution)",
+            std::make_tuple(
+                mimicpp::detail::arg_storage<
+                    MatcherT,
+                    std::identity,
+                    decltype([](const auto& m) { return mimicpp::detail::describe_hook::describe(m); })>{
+                    std::forward<MatcherT>(matcher)},
+                detail::make_policy_storage(std::forward<Policy>(policy)))};
+    }
+
+    /**
+     * \brief Tests, whether any element of the target range matches the specified matcher with the given execution policy.
+     * \param policy The execution policy.
+     * \param matcher The matcher.
+     * \details The policy is just applied, if the target is random-access and has at least \ref detail::parallelThreshold
+     * elements. Otherwise, it's inspected sequentially.
+     * \attention The matcher may be invoked concurrently, thus it must be safe to do so.
+     * \note Requires \ref MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS.
+     */
+    template <detail::execution_policy Policy, typename Matcher>
+    [[nodiscard]]
+    constexpr auto any_element(Policy&& policy, Matcher&& matcher)
+    {
+        using MatcherT = std::remove_cvref_t<Matcher>;
+        return PredicateMatcher{
+            []<std::ranges::range Target>(Target&& target, const MatcherT& m, const auto& pol) { // NOLINT(cppcoreguidelines-missing-std-forward)
+                auto matches = [&](const auto& element) { return m.matches(element); };
+                if constexpr (detail::parallel_range<Target&>)
+                {
+                    if (detail::is_parallelizable(target))
+                    {
+                        return std::any_of(pol, std::ranges::begin(target), std::ranges::end(target), matches);
+                    }
+                }
+
+                return std::ranges::any_of(target, matches);
+            },
+            "any el in range: el {} ({} execution)",
+            "none el in range: el {} ({} execution)",
+            std::make_tuple(
+                mimicpp::detail::arg_storage<
+                    MatcherT,
+                    std::identity,
+                    decltype([](const auto& m) { return mimicpp::detail::describe_hook::describe(m); })>{
+                    std::forward<MatcherT>(matcher)},
+                detail::make_policy_storage(std::forward<Policy>(policy)))};
+    }
+
+#endif
+
     /**
      * \}
      */
@@ -0,0 +1,274 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MIMICPP_MATCHERS_REGEX_MATCHERS_HPP
+#define MIMICPP_MATCHERS_REGEX_MATCHERS_HPP
+
+#pragma once
+
+#include "mimic++/Fwd.hpp"
+#include "mimic++/String.hpp"
+#include "mimic++/matchers/GeneralMatchers.hpp"
+#include "mimic++/matchers/StringMatchers.hpp"
+
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#ifdef MIMICPP_CONFIG_USE_RE2
+    #if __has_include(<re2/re2.h>)
+        #include <re2/re2.h>
+    #else
+        #error "Unable to find re2 includes."
+    #endif
+#else
+    #include <regex>
+#endif
+
+namespace mimicpp::matches::str
+{
+    /**
+     * \brief The option type of the active regex backend.
+     * \details This is ``std::regex_constants::syntax_option_type`` by default and ``re2::RE2::Options``, if
+     * \ref MIMICPP_CONFIG_USE_RE2 is enabled.
+     * \ingroup MATCHERS_STRING_REGEX
+     */
+#ifdef MIMICPP_CONFIG_USE_RE2
+    using RegexOptionsT = re2::RE2::Options;
+#else
+    using RegexOptionsT = std::regex_constants::syntax_option_type;
+#endif
+}
+
+namespace mimicpp::matches::detail
+{
+    [[nodiscard]]
+    inline str::RegexOptionsT make_regex_options(const bool caseInsensitive)
+    {
+#ifdef MIMICPP_CONFIG_USE_RE2
+        str::RegexOptionsT options{};
+        options.set_case_sensitive(!caseInsensitive);
+        return options;
+#else
+        return caseInsensitive
+                 ? std::regex::ECMAScript | std::regex::icase
+                 : std::regex::ECMAScript;
+#endif
+    }
+
+    [[nodiscard]]
+    inline bool is_case_insensitive(const str::RegexOptionsT& options) noexcept
+    {
+#ifdef MIMICPP_CONFIG_USE_RE2
+        return !options.case_sensitive();
+#else
+        return str::RegexOptionsT{} != (options & std::regex::icase);
+#endif
+    }
+
+    /**
+     * \brief Holds a compiled regular expression together with its source text.
+     * \details The expression is compiled exactly once during the construction. Copies share the compiled expression.
+     */
+    class CompiledRegex
+    {
+    public:
+        [[nodiscard]]
+        explicit CompiledRegex(std::string pattern, const str::RegexOptionsT& options)
+            : m_Pattern{std::move(pattern)},
+              m_Regex{compile(m_Pattern, options)}
+        {
+        }
+
+        [[nodiscard]]
+        const std::string& pattern() const noexcept
+        {
+            return m_Pattern;
+        }
+
+        [[nodiscard]]
+        bool matches(const std::string_view target) const
+        {
+#ifdef MIMICPP_CONFIG_USE_RE2
+            return re2::RE2::FullMatch(target, *m_Regex);
+#else
+            return std::regex_match(
+                target.data(),
+                target.data() + target.size(),
+                *m_Regex);
+#endif
+        }
+
+    private:
+#ifdef MIMICPP_CONFIG_USE_RE2
+        using RegexT = re2::RE2;
+#else
+        using RegexT = std::regex;
+#endif
+
+        std::string m_Pattern;
+        std::shared_ptr<const RegexT> m_Regex;
+
+        [[nodiscard]]
+        static std::shared_ptr<const RegexT> compile(const std::string& pattern, str::RegexOptionsT options)
+        {
+#ifdef MIMICPP_CONFIG_USE_RE2
+            options.set_log_errors(false);
+
+            auto regex = std::make_shared<const re2::RE2>(pattern, options);
+            if (!regex->ok())
+            {
+                throw std::runtime_error{"Invalid regex pattern: " + regex->error()};
+            }
+
+            return regex;
+#else
+            // throws std::regex_error, if the pattern is invalid
+            return std::make_shared<const std::regex>(pattern, options | std::regex::optimize);
+#endif
+        }
+    };
+
+    struct describe_regex_fn
+    {
+        [[nodiscard]]
+        StringT operator()(const CompiledRegex& regex) const
+        {
+            return mimicpp::print(regex.pattern());
+        }
+    };
+
+    template <typename String>
+    concept regex_string = string<String>
+                        && std::same_as<char, string_char_t<String>>;
+
+    template <regex_string Pattern>
+    [[nodiscard]]
+    std::string to_std_string(Pattern&& pattern)
+    {
+        auto view = matches::detail::make_view(std::forward<Pattern>(pattern));
+        return std::string{std::ranges::data(view), std::ranges::size(view)};
+    }
+
+    template <regex_string Target>
+    [[nodiscard]]
+    std::string_view to_std_string_view(Target&& target)
+    {
+        auto view = matches::detail::make_view(std::forward<Target>(target));
+        return std::string_view{std::ranges::data(view), std::ranges::size(view)};
+    }
+
+    [[nodiscard]]
+    inline auto make_regex_matcher(
+        std::string pattern,
+        const str::RegexOptionsT& options)
+    {
+        const bool caseInsensitive = detail::is_case_insensitive(options);
+        return PredicateMatcher{
+            []<regex_string T>(T&& target, const CompiledRegex& regex) {
+                return regex.matches(detail::to_std_string_view(std::forward<T>(target)));
+            },
+            caseInsensitive ? "case-insensitively matches regex {}" : "matches regex {}",
+            caseInsensitive ? "case-insensitively does not match regex {}" : "does not match regex {}",
+            std::make_tuple(
+                mimicpp::detail::arg_storage<
+                    CompiledRegex,
+                    std::identity,
+                    describe_regex_fn>{
+                    CompiledRegex{std::move(pattern), options}})};
+    }
+}
+
+namespace mimicpp::detail
+{
+    // The compiled regex owns its pattern.
+    template <>
+    struct is_stable_description_arg<matches::detail::CompiledRegex>
+        : public std::true_type
+    {
+    };
+}
+
+namespace mimicpp::matches::str
+{
+    /**
+     * \defgroup MATCHERS_STRING_REGEX regex matchers
+     * \ingroup MATCHERS_STRING
+     * \brief Matchers, which test strings against regular expressions.
+     * \details The expression is compiled once, when the matcher is created, and then reused for each call.
+     * The whole target must match the expression; prepend and append ``.*`` to search within the target instead.
+     * Invalid patterns are reported by an exception during the construction.
+     *
+     * By default, ``std::regex`` with the ``ECMAScript`` grammar serves as backend.
+     * Alternatively, ``re2`` can be used by enabling \ref MIMICPP_CONFIG_USE_RE2.
+     *
+     * \note Regex matchers just support ``char``-strings.
+     *
+     * \attention This header is not part of ``mimic++/mimic++.hpp``, as the backend is rather heavy to compile.
+     * Include ``mimic++/matchers/RegexMatchers.hpp`` explicitly, when regex matchers are used.
+     *
+     * \snippet Requirements.cpp matcher str regex
+     *
+     *\{
+     */
+
+    /**
+     * \brief Tests, whether the target string matches the given regular expression.
+     * \tparam Pattern The string type.
+     * \param pattern The expression.
+     */
+    template <detail::regex_string Pattern>
+    [[nodiscard]]
+    auto regex(Pattern&& pattern)
+    {
+        return detail::make_regex_matcher(
+            detail::to_std_string(std::forward<Pattern>(pattern)),
+            detail::make_regex_options(false));
+    }
+
+    /**
+     * \brief Tests, whether the target string case-insensitively matches the given regular expression.
+     * \tparam Pattern The string type.
+     * \param pattern The expression.
+     */
+    template <detail::regex_string Pattern>
+    [[nodiscard]]
+    auto regex(Pattern&& pattern, [[maybe_unused]] const case_insensitive_t)
+    {
+        return detail::make_regex_matcher(
+            detail::to_std_string(std::forward<Pattern>(pattern)),
+            detail::make_regex_options(true));
+    }
+
+    /**
+     * \brief Tests, whether the target string matches the given regular expression, which is compiled with the given options.
+     * \tparam Pattern The string type.
+     * \param pattern The expression.
+     * \param options The options of the active backend (e.g. ``std::regex::extended | std::regex::icase``).
+     * \details Case-insensitive options are reflected in the description.
+     * \note The ``std::regex`` backend always adds ``std::regex::optimize``, as the expression is reused for each call.
+     */
+    template <detail::regex_string Pattern>
+    [[nodiscard]]
+    auto regex(Pattern&& pattern, const RegexOptionsT& options)
+    {
+        return detail::make_regex_matcher(
+            detail::to_std_string(std::forward<Pattern>(pattern)),
+            options);
+    }
+
+    /**
+     * \}
+     */
+}
+
+#endif
@@ -11,10 +11,20 @@
 #include "mimic++/matchers/GeneralMatchers.hpp"
 
 #include <algorithm>
+#include <array>
 #include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
 #include <ranges>
+#include <span>
+#include <string_view>
 #include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace mimicpp
 {
@@ -55,6 +65,915 @@ namespace mimicpp::matches::detail
                 string_char_t<Pattern>>,
             "Pattern and target string must have the same character-type.");
     }
+
+    /**
+     * \brief Determines, whether two (already converted) strings can be compared via their object-representation.
+     * \details This holds for contiguous strings with the same integral character-type.
+     * User-defined character-types are never compared that way.
+     */
+    template <typename Target, typename Pattern>
+    concept bitwise_comparable_strings = std::ranges::contiguous_range<Target>
+                                      && std::ranges::sized_range<Target>
+                                      && std::ranges::contiguous_range<Pattern>
+                                      && std::ranges::sized_range<Pattern>
+                                      && std::integral<std::ranges::range_value_t<Target>>
+                                      && std::same_as<
+                                             std::ranges::range_value_t<Target>,
+                                             std::ranges::range_value_t<Pattern>>;
+
+    template <typename Char>
+    [[nodiscard]]
+    inline bool bitwise_equal(const Char* const lhs, const Char* const rhs, const std::size_t length) noexcept
+    {
+        return 0u == length
+            || 0 == std::memcmp(lhs, rhs, length * sizeof(Char));
+    }
+
+    /**
+     * \brief Compares the element-wise folded target with the already folded pattern.
+     * \details The elements are compared in blocks without early-exits, which lets the compiler vectorize the inner loop.
+     */
+    template <std::integral Char, typename Fold>
+    [[nodiscard]]
+    constexpr bool folded_equal(
+        const Char* const target,
+        const Char* const foldedPattern,
+        const std::size_t length,
+        const Fold& fold) noexcept
+    {
+        using UnsignedT = std::make_unsigned_t<Char>;
+        constexpr std::size_t blockSize{32u};
+
+        std::size_t i{0u};
+        for (; i + blockSize <= length; i += blockSize)
+        {
+            UnsignedT diff{};
+            for (std::size_t j{0u}; j < blockSize; ++j)
+            {
+                diff = static_cast<UnsignedT>(
+                    diff
+                    | (static_cast<UnsignedT>(std::invoke(fold, target[i + j]))
+                       ^ static_cast<UnsignedT>(foldedPattern[i + j])));
+            }
+
+            if (0u != diff)
+            {
+                return false;
+            }
+        }
+
+        for (; i < length; ++i)
+        {
+            if (std::invoke(fold, target[i]) != foldedPattern[i])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename Char, typename Projection>
+    [[nodiscard]]
+    bool projected_equal(
+        const Char* const target,
+        const Char* const pattern,
+        const std::size_t length,
+        const Projection& projection) noexcept
+    {
+        if constexpr (std::same_as<std::identity, Projection>)
+        {
+            return detail::bitwise_equal(target, pattern, length);
+        }
+        else
+        {
+            return detail::folded_equal(target, pattern, length, projection);
+        }
+    }
+
+    /**
+     * \brief Searches for the pattern, by scanning for its first element and then comparing the remainder.
+     * \details For byte-strings, ``std::memchr`` is used, which is vectorized by all major standard-libraries.
+     */
+    template <typename Char>
+    [[nodiscard]]
+    bool bitwise_contains(
+        const Char* first,
+        const std::size_t targetLength,
+        const Char* const pattern,
+        const std::size_t patternLength) noexcept
+    {
+        if (0u == patternLength)
+        {
+            return true;
+        }
+
+        if (targetLength < patternLength)
+        {
+            return false;
+        }
+
+        const Char head = pattern[0];
+        const Char tail = pattern[patternLength - 1u];
+        // the last position, where a match may begin
+        const Char* const last = first + (targetLength - patternLength) + 1u;
+        while (first != last)
+        {
+            if constexpr (1u == sizeof(Char))
+            {
+                first = static_cast<const Char*>(
+                    std::memchr(first, static_cast<unsigned char>(head), static_cast<std::size_t>(last - first)));
+                if (!first)
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                first = std::find(first, last, head);
+                if (first == last)
+                {
+                    return false;
+                }
+            }
+
+            // checking the last element first rejects most candidates early
+            if (first[patternLength - 1u] == tail
+                && bitwise_equal(first + 1, pattern + 1, patternLength - 1u))
+            {
+                return true;
+            }
+
+            ++first;
+        }
+
+        return false;
+    }
+
+    template <std::ranges::forward_range Target, std::ranges::forward_range Pattern>
+    [[nodiscard]]
+    constexpr bool string_equal(Target&& target, Pattern&& pattern)
+    {
+        if constexpr (bitwise_comparable_strings<Target, Pattern>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const std::size_t length = std::ranges::size(pattern);
+                return length == std::ranges::size(target)
+                    && detail::bitwise_equal(std::ranges::data(target), std::ranges::data(pattern), length);
+            }
+        }
+
+        return std::ranges::equal(target, pattern);
+    }
+
+    template <std::ranges::forward_range Target, std::ranges::forward_range Pattern>
+    [[nodiscard]]
+    constexpr bool string_starts_with(Target&& target, Pattern&& pattern)
+    {
+        if constexpr (bitwise_comparable_strings<Target, Pattern>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const std::size_t length = std::ranges::size(pattern);
+                return length <= std::ranges::size(target)
+                    && detail::bitwise_equal(std::ranges::data(target), std::ranges::data(pattern), length);
+            }
+        }
+
+        const auto [ignore, patternIter] = std::ranges::mismatch(target, pattern);
+        return patternIter == std::ranges::end(pattern);
+    }
+
+    template <std::ranges::bidirectional_range Target, std::ranges::bidirectional_range Pattern>
+    [[nodiscard]]
+    constexpr bool string_ends_with(Target&& target, Pattern&& pattern)
+    {
+        if constexpr (bitwise_comparable_strings<Target, Pattern>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const std::size_t length = std::ranges::size(pattern);
+                const std::size_t targetLength = std::ranges::size(target);
+                return length <= targetLength
+                    && detail::bitwise_equal(
+                           std::ranges::data(target) + (targetLength - length),
+                           std::ranges::data(pattern),
+                           length);
+            }
+        }
+
+        auto reversedPattern = pattern | std::views::reverse;
+        const auto [ignore, patternIter] = std::ranges::mismatch(
+            target | std::views::reverse,
+            reversedPattern);
+        return patternIter == std::ranges::end(reversedPattern);
+    }
+
+    template <std::ranges::forward_range Target, std::ranges::forward_range Pattern>
+    [[nodiscard]]
+    constexpr bool string_contains(Target&& target, Pattern&& pattern)
+    {
+        if constexpr (bitwise_comparable_strings<Target, Pattern>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return detail::bitwise_contains(
+                    std::ranges::data(target),
+                    std::ranges::size(target),
+                    std::ranges::data(pattern),
+                    std::ranges::size(pattern));
+            }
+        }
+
+        return std::ranges::empty(pattern)
+            || !std::ranges::empty(std::ranges::search(target, pattern));
+    }
+
+    /**
+     * \brief The bad-character table of the Boyer-Moore-Horspool algorithm.
+     * \details Elements are mapped onto their lowest byte, thus wider character-types share a single bucket for multiple
+     * elements. As each bucket stores the minimal shift of all its elements, this is still correct.
+     */
+    template <std::integral Char>
+    class HorspoolTable
+    {
+    public:
+        [[nodiscard]]
+        constexpr HorspoolTable() noexcept = default;
+
+        [[nodiscard]]
+        constexpr HorspoolTable(const Char* const pattern, const std::size_t length) noexcept
+        {
+            m_Shifts.fill(length);
+            if (0u == length)
+            {
+                return;
+            }
+
+            for (std::size_t i{0u}; i + 1u < length; ++i)
+            {
+                m_Shifts[index_of(pattern[i])] = length - 1u - i;
+            }
+
+            // The bucket of the last element is reset to zero, which lets the skip-loop stop at each candidate.
+            // The actual shift is restored after the candidate has been checked.
+            const std::size_t lastIndex = index_of(pattern[length - 1u]);
+            m_CandidateShift = m_Shifts[lastIndex];
+            m_Shifts[lastIndex] = 0u;
+        }
+
+        /**
+         * \brief Searches for the pattern, for which the table has been built.
+         * \details The projection is applied on each target element before it's inspected.
+         * \attention The pattern must not be empty.
+         */
+        template <typename Projection = std::identity>
+        [[nodiscard]]
+        bool contains(
+            const Char* const target,
+            const std::size_t targetLength,
+            const Char* const pattern,
+            const std::size_t patternLength,
+            const Projection& projection = {}) const noexcept
+        {
+            if (targetLength < patternLength)
+            {
+                return false;
+            }
+
+            const std::size_t lastIndex = patternLength - 1u;
+            // the index of the target element, which is aligned with the last pattern element
+            std::size_t current{lastIndex};
+            while (current < targetLength)
+            {
+                // skip-loop
+                std::size_t shift{};
+                while (0u != (shift = m_Shifts[index_of(std::invoke(projection, target[current]))]))
+                {
+                    current += shift;
+                    if (targetLength <= current)
+                    {
+                        return false;
+                    }
+                }
+
+                if (std::invoke(projection, target[current]) == pattern[lastIndex]
+                    && detail::projected_equal(target + (current - lastIndex), pattern, lastIndex, projection))
+                {
+                    return true;
+                }
+
+                current += m_CandidateShift;
+            }
+
+            return false;
+        }
+
+    private:
+        std::array<std::size_t, 256u> m_Shifts{};
+        std::size_t m_CandidateShift{};
+
+        [[nodiscard]]
+        static constexpr std::size_t index_of(const Char c) noexcept
+        {
+            return static_cast<std::size_t>(static_cast<std::make_unsigned_t<Char>>(c) & 0xFFu);
+        }
+    };
+
+    /**
+     * \brief Patterns with less elements are searched via ``bitwise_contains``, as the table can not outperform the
+     * (vectorized) linear scan.
+     */
+    inline constexpr std::size_t horspoolThreshold{16u};
+
+    /**
+     * \brief The search-table of a stored pattern.
+     * \details The table is rather large, thus it's just allocated for patterns, which actually use it.
+     * It's immutable after construction and therefore shared between copies (e.g. inverted matchers).
+     */
+    template <typename Char>
+    struct search_table
+    {
+        using type = std::tuple<>;
+    };
+
+    template <std::integral Char>
+    struct search_table<Char>
+    {
+        using type = std::shared_ptr<const HorspoolTable<Char>>;
+    };
+
+    template <std::integral Char>
+    [[nodiscard]]
+    std::shared_ptr<const HorspoolTable<Char>> make_search_table(const Char* const pattern, const std::size_t length)
+    {
+        if (length < horspoolThreshold)
+        {
+            return nullptr;
+        }
+
+        return std::make_shared<const HorspoolTable<Char>>(pattern, length);
+    }
+
+    /**
+     * \brief Stores the pattern of a ``contains`` matcher together with its precomputed search-table.
+     * \details The table is built once during the construction and then reused for each ``matches`` call.
+     * Patterns shorter than ``horspoolThreshold`` don't need any table, thus none is allocated.
+     */
+    template <string Pattern>
+    class SearchablePattern
+    {
+    public:
+        using char_t = string_char_t<Pattern>;
+
+        [[nodiscard]]
+        explicit constexpr SearchablePattern(Pattern pattern)
+            : m_Pattern{std::move(pattern)}
+        {
+            if constexpr (std::integral<char_t>)
+            {
+                const auto view = detail::make_view(std::as_const(m_Pattern));
+                m_Table = detail::make_search_table(std::ranges::data(view), std::ranges::size(view));
+            }
+        }
+
+        [[nodiscard]]
+        constexpr const Pattern& pattern() const noexcept
+        {
+            return m_Pattern;
+        }
+
+        template <string Target>
+        [[nodiscard]]
+        constexpr bool is_part_of(Target&& target) const
+        {
+            auto targetView = detail::make_view(std::forward<Target>(target));
+            auto patternView = detail::make_view(m_Pattern);
+            if constexpr (bitwise_comparable_strings<decltype(targetView), decltype(patternView)>)
+            {
+                if (!std::is_constant_evaluated()
+                    && m_Table)
+                {
+                    return m_Table->contains(
+                        std::ranges::data(targetView),
+                        std::ranges::size(targetView),
+                        std::ranges::data(patternView),
+                        std::ranges::size(patternView));
+                }
+            }
+
+            return detail::string_contains(std::move(targetView), std::move(patternView));
+        }
+
+    private:
+        using TableT = typename search_table<char_t>::type;
+
+        Pattern m_Pattern;
+        [[no_unique_address]] TableT m_Table{};
+    };
+
+    /**
+     * \brief Determines, whether the case-fold converter of the given character-type folds each element independently.
+     * \details Such converters provide a static ``fold`` function, which lets matchers compare contiguous strings directly,
+     * without converting them first.
+     */
+    template <typename Char>
+    concept elementwise_case_foldable = std::integral<Char>
+                                     && requires(const Char c) {
+                                            { string_case_fold_converter<Char>::fold(c) } -> std::same_as<Char>;
+                                        };
+
+    /**
+     * \brief Determines, whether the case-fold converter of the given character-type supports folding strings piece by piece.
+     * \details Such converters provide a static ``code_point_boundary`` function, which moves a position onto the start
+     * of the code-point it's part of.
+     */
+    template <typename Char>
+    concept chunkwise_case_foldable = requires(const std::basic_string_view<Char> str, const std::size_t pos) {
+        { string_case_fold_converter<Char>::code_point_boundary(str, pos) } -> std::convertible_to<std::size_t>;
+    };
+
+    /**
+     * \brief Folds the given string piece by piece and passes each folded piece to the visitor.
+     * \details The pieces grow exponentially and the process stops, as soon as the visitor returns ``false``.
+     * Thus, the whole folded string is never materialized at once.
+     * \tparam reversed Determines, whether the string shall be processed from its end.
+     */
+    template <bool reversed, chunkwise_case_foldable Char, typename Visitor>
+    constexpr void for_each_folded_chunk(const std::basic_string_view<Char> str, Visitor visitor)
+    {
+        using ConverterT = string_case_fold_converter<Char>;
+
+        std::size_t chunkLength{64u};
+        std::size_t begin{0u};
+        std::size_t end{str.size()};
+        while (begin < end)
+        {
+            std::size_t first{begin};
+            std::size_t last{end};
+            if (chunkLength < end - begin)
+            {
+                if constexpr (reversed)
+                {
+                    first = ConverterT::code_point_boundary(str, end - chunkLength);
+                }
+                else
+                {
+                    last = ConverterT::code_point_boundary(str, begin + chunkLength);
+                    // malformed input may consist of an arbitrary long sequence of continuation elements
+                    if (last <= begin)
+                    {
+                        last = begin + chunkLength;
+                    }
+                }
+            }
+
+            if (!std::invoke(visitor, std::invoke(ConverterT{}, str.substr(first, last - first))))
+            {
+                return;
+            }
+
+            if constexpr (reversed)
+            {
+                end = first;
+            }
+            else
+            {
+                begin = last;
+            }
+            chunkLength *= 2u;
+        }
+    }
+
+    template <typename Char>
+    struct fold_element_fn
+    {
+        [[nodiscard]]
+        constexpr Char operator()(const Char c) const noexcept
+        {
+            return string_case_fold_converter<Char>::fold(c);
+        }
+    };
+
+    /**
+     * \brief Stores the pattern of a case-insensitive matcher together with its case-folded representation.
+     * \details The pattern is folded once during the construction, thus each ``matches`` call just has to fold the target.
+     * When the converter folds element-wise, contiguous targets aren't converted at all, but folded during the comparison.
+     * When the converter supports folding piece by piece, the comparisons stop at the first mismatch, without folding the
+     * remainder of the target.
+     */
+    template <case_foldable_string Pattern>
+    class CaseFoldedPattern
+    {
+    public:
+        using char_t = string_char_t<Pattern>;
+
+        [[nodiscard]]
+        explicit constexpr CaseFoldedPattern(Pattern pattern)
+            : m_Pattern{std::move(pattern)}
+        {
+            std::ranges::copy(
+                detail::make_case_folded_string(std::as_const(m_Pattern)),
+                std::back_inserter(m_Folded));
+
+            // the table is solely used by the element-wise folding strategy
+            if constexpr (elementwise_foldable_view<decltype(m_Folded)>)
+            {
+                m_Table = detail::make_search_table(m_Folded.data(), m_Folded.size());
+            }
+        }
+
+        [[nodiscard]]
+        constexpr const Pattern& pattern() const noexcept
+        {
+            return m_Pattern;
+        }
+
+        template <case_foldable_string Target>
+        [[nodiscard]]
+        constexpr bool equals(Target&& target) const
+        {
+            auto targetView = detail::make_view(std::forward<Target>(target));
+            if constexpr (elementwise_foldable_view<decltype(targetView)>)
+            {
+                return std::ranges::size(targetView) == m_Folded.size()
+                    && detail::folded_equal(std::ranges::data(targetView), m_Folded.data(), m_Folded.size(), FoldT{});
+            }
+            else if constexpr (chunkwise_case_foldable<char_t>)
+            {
+                std::size_t offset{0u};
+                bool result{true};
+                detail::for_each_folded_chunk<false>(
+                    to_string_view(targetView),
+                    [&](const auto& chunk) {
+                        const std::size_t length = std::ranges::size(chunk);
+                        result = length <= m_Folded.size() - offset
+                              && detail::string_equal(chunk, folded_subrange(offset, length));
+                        offset += length;
+                        return result;
+                    });
+
+                return result && offset == m_Folded.size();
+            }
+            else
+            {
+                return detail::string_equal(fold(std::move(targetView)), m_Folded);
+            }
+        }
+
+        template <case_foldable_string Target>
+        [[nodiscard]]
+        constexpr bool is_prefix_of(Target&& target) const
+        {
+            auto targetView = detail::make_view(std::forward<Target>(target));
+            if constexpr (elementwise_foldable_view<decltype(targetView)>)
+            {
+                return m_Folded.size() <= std::ranges::size(targetView)
+                    && detail::folded_equal(std::ranges::data(targetView), m_Folded.data(), m_Folded.size(), FoldT{});
+            }
+            else if constexpr (chunkwise_case_foldable<char_t>)
+            {
+                std::size_t offset{0u};
+                bool result{true};
+                detail::for_each_folded_chunk<false>(
+                    to_string_view(targetView),
+                    [&](const auto& chunk) {
+                        const std::size_t length = std::min(std::ranges::size(chunk), m_Folded.size() - offset);
+                        result = detail::string_equal(
+                            std::ranges::subrange{std::ranges::begin(chunk), std::ranges::begin(chunk) + length},
+                            folded_subrange(offset, length));
+                        offset += length;
+                        return result && offset < m_Folded.size();
+                    });
+
+                return result && offset == m_Folded.size();
+            }
+            else
+            {
+                return detail::string_starts_with(fold(std::move(targetView)), m_Folded);
+            }
+        }
+
+        template <case_foldable_string Target>
+        [[nodiscard]]
+        constexpr bool is_suffix_of(Target&& target) const
+        {
+            auto targetView = detail::make_view(std::forward<Target>(target));
+            if constexpr (elementwise_foldable_view<decltype(targetView)>)
+            {
+                const std::size_t targetLength = std::ranges::size(targetView);
+                return m_Folded.size() <= targetLength
+                    && detail::folded_equal(
+                           std::ranges::data(targetView) + (targetLength - m_Folded.size()),
+                           m_Folded.data(),
+                           m_Folded.size(),
+                           FoldT{});
+            }
+            else if constexpr (chunkwise_case_foldable<char_t>)
+            {
+                // the amount of folded pattern elements, which have already been compared from the end
+                std::size_t processed{0u};
+                bool result{true};
+                detail::for_each_folded_chunk<true>(
+                    to_string_view(targetView),
+                    [&](const auto& chunk) {
+                        const std::size_t length = std::min(std::ranges::size(chunk), m_Folded.size() - processed);
+                        result = detail::string_equal(
+                            std::ranges::subrange{std::ranges::end(chunk) - length, std::ranges::end(chunk)},
+                            folded_subrange(m_Folded.size() - processed - length, length));
+                        processed += length;
+                        return result && processed < m_Folded.size();
+                    });
+
+                return result && processed == m_Folded.size();
+            }
+            else
+            {
+                return detail::string_ends_with(fold(std::move(targetView)), m_Folded);
+            }
+        }
+
+        template <case_foldable_string Target>
+        [[nodiscard]]
+        constexpr bool is_part_of(Target&& target) const
+        {
+            auto targetView = detail::make_view(std::forward<Target>(target));
+            if constexpr (elementwise_foldable_view<decltype(targetView)>)
+            {
+                if (!std::is_constant_evaluated()
+                    && m_Table)
+                {
+                    return m_Table->contains(
+                            std::ranges::data(targetView),
+                            std::ranges::size(targetView),
+                            m_Folded.data(),
+                            m_Folded.size(),
+                            FoldT{});
+                }
+            }
+
+            return detail::string_contains(fold(std::move(targetView)), m_Folded);
+        }
+
+    private:
+        using FoldT = fold_element_fn<char_t>;
+        using TableT = typename search_table<char_t>::type;
+
+        template <typename View>
+        static constexpr bool elementwise_foldable_view = elementwise_case_foldable<char_t>
+                                                       && std::ranges::contiguous_range<View>
+                                                       && std::ranges::sized_range<View>;
+
+        Pattern m_Pattern;
+        std::vector<char_t> m_Folded{};
+        [[no_unique_address]] TableT m_Table{};
+
+        [[nodiscard]]
+        constexpr auto folded_subrange(const std::size_t offset, const std::size_t length) const noexcept
+        {
+            return std::span{m_Folded}.subspan(offset, length);
+        }
+
+        template <typename View>
+        [[nodiscard]]
+        static constexpr std::basic_string_view<char_t> to_string_view(const View& view) noexcept
+        {
+            return std::basic_string_view<char_t>{std::ranges::data(view), std::ranges::size(view)};
+        }
+
+        template <typename View>
+        [[nodiscard]]
+        static constexpr auto fold(View&& view)
+        {
+            return std::invoke(
+                string_case_fold_converter<char_t>{},
+                std::forward<View>(view));
+        }
+    };
+
+    struct describe_stored_pattern_fn
+    {
+        template <typename Stored>
+        [[nodiscard]]
+        decltype(auto) operator()(const Stored& stored) const
+        {
+            return mimicpp::print(stored.pattern());
+        }
+    };
+}
+
+namespace mimicpp::detail
+{
+    template <typename Pattern>
+    struct is_stable_description_arg<matches::detail::SearchablePattern<Pattern>>
+        : public is_stable_description_arg<Pattern>
+    {
+    };
+
+    template <typename Pattern>
+    struct is_stable_description_arg<matches::detail::CaseFoldedPattern<Pattern>>
+        : public is_stable_description_arg<Pattern>
+    {
+    };
+}
+
+namespace mimicpp::matches::detail
+{
+    /**
+     * \brief A byte-string literal, which can be used as non-type template-parameter.
+     * \tparam length The amount of characters (without the terminating null).
+     */
+    template <std::size_t length>
+    struct FixedString
+    {
+        // Must be public, as otherwise the type is not structural.
+        CharT chars[length + 1u]{};
+
+        /**
+         * \brief Copies the given literal.
+         * \note This constructor is intentionally implicit, as otherwise literals can not be used as template-arguments.
+         */
+        [[nodiscard]]
+        consteval FixedString(const CharT (&str)[length + 1u]) noexcept
+        {
+            std::ranges::copy(str, chars);
+        }
+
+        [[nodiscard]]
+        static consteval std::size_t size() noexcept
+        {
+            return length;
+        }
+
+        [[nodiscard]]
+        constexpr StringViewT view() const noexcept
+        {
+            return StringViewT{chars, length};
+        }
+    };
+
+    template <std::size_t size>
+    FixedString(const CharT (&)[size]) -> FixedString<size - 1u>;
+
+    /**
+     * \brief Patterns up to this length are compared element-wise via a fully unrolled expression.
+     */
+    inline constexpr std::size_t literalUnrollThreshold{16u};
+
+    template <FixedString pattern>
+    [[nodiscard]]
+    constexpr bool literal_equal_at(const CharT* const target) noexcept
+    {
+        if constexpr (pattern.size() <= literalUnrollThreshold)
+        {
+            // Each comparison is against a constant, thus no pattern element must be loaded during runtime.
+            return std::invoke(
+                [&]<std::size_t... indices>([[maybe_unused]] const std::index_sequence<indices...>) noexcept {
+                    return ((target[indices] == pattern.chars[indices]) && ...);
+                },
+                std::make_index_sequence<pattern.size()>{});
+        }
+        else
+        {
+            if (std::is_constant_evaluated())
+            {
+                return std::ranges::equal(
+                    StringViewT{target, pattern.size()},
+                    pattern.view());
+            }
+
+            return detail::bitwise_equal(target, pattern.chars, pattern.size());
+        }
+    }
+
+    template <FixedString pattern>
+    inline constexpr HorspoolTable<CharT> literalSearchTable{pattern.chars, pattern.size()};
+
+    /**
+     * \brief Concatenates the given format-prefix and the printed pattern during compile-time.
+     */
+    template <FixedString prefix, FixedString pattern>
+    inline constexpr auto literalDescription = std::invoke([] {
+        std::array<CharT, prefix.size() + pattern.size() + 2u> buffer{};
+        auto iter = std::ranges::copy(prefix.view(), buffer.begin()).out;
+        *iter++ = '"';
+        iter = std::ranges::copy(pattern.view(), iter).out;
+        *iter = '"';
+
+        return buffer;
+    });
+
+    struct literal_equal_fn
+    {
+        static constexpr FixedString format{"is equal to "};
+        static constexpr FixedString invertedFormat{"is not equal to "};
+
+        template <FixedString pattern>
+        [[nodiscard]]
+        static constexpr bool matches(const StringViewT target) noexcept
+        {
+            return pattern.size() == target.size()
+                && detail::literal_equal_at<pattern>(target.data());
+        }
+    };
+
+    struct literal_starts_with_fn
+    {
+        static constexpr FixedString format{"starts with "};
+        static constexpr FixedString invertedFormat{"starts not with "};
+
+        template <FixedString pattern>
+        [[nodiscard]]
+        static constexpr bool matches(const StringViewT target) noexcept
+        {
+            return pattern.size() <= target.size()
+                && detail::literal_equal_at<pattern>(target.data());
+        }
+    };
+
+    struct literal_ends_with_fn
+    {
+        static constexpr FixedString format{"ends with "};
+        static constexpr FixedString invertedFormat{"ends not with "};
+
+        template <FixedString pattern>
+        [[nodiscard]]
+        static constexpr bool matches(const StringViewT target) noexcept
+        {
+            return pattern.size() <= target.size()
+                && detail::literal_equal_at<pattern>(target.data() + (target.size() - pattern.size()));
+        }
+    };
+
+    struct literal_contains_fn
+    {
+        static constexpr FixedString format{"contains "};
+        static constexpr FixedString invertedFormat{"contains not "};
+
+        template <FixedString pattern>
+        [[nodiscard]]
+        static constexpr bool matches(const StringViewT target) noexcept
+        {
+            if constexpr (horspoolThreshold <= pattern.size())
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    return literalSearchTable<pattern>.contains(
+                        target.data(),
+                        target.size(),
+                        pattern.chars,
+                        pattern.size());
+                }
+            }
+
+            return detail::string_contains(target, pattern.view());
+        }
+    };
+
+    /**
+     * \brief Matcher, which has its pattern and its description baked into its type.
+     * \details Neither the pattern nor the description are stored in the matcher object, and the description is built
+     * during compile-time.
+     */
+    template <typename Algorithm, FixedString pattern, bool inverted>
+    class LiteralStringMatcher
+    {
+    public:
+        template <string Target>
+            requires std::same_as<string_char_t<Target>, string_char_t<StringViewT>>
+        [[nodiscard]]
+        constexpr bool matches(Target& target) const
+        {
+            auto view = detail::make_view(target);
+            return inverted
+                != Algorithm::template matches<pattern>(
+                    StringViewT{std::ranges::data(view), std::ranges::size(view)});
+        }
+
+        [[nodiscard]]
+        static constexpr StringViewT describe() noexcept
+        {
+            constexpr auto& description = std::invoke([]() -> auto& {
+                if constexpr (inverted)
+                {
+                    return literalDescription<Algorithm::invertedFormat, pattern>;
+                }
+                else
+                {
+                    return literalDescription<Algorithm::format, pattern>;
+                }
+            });
+
+            return StringViewT{description.data(), description.size()};
+        }
+
+        [[nodiscard]]
+        constexpr auto operator!() const noexcept
+        {
+            return LiteralStringMatcher<Algorithm, pattern, !inverted>{};
+        }
+    };
 }
 
 namespace mimicpp::matches::str
@@ -66,6 +985,8 @@ namespace mimicpp::matches::str
      * \details These matchers are designed to work with any string- and character-type.
      * This comes with some caveats and restrictions, e.g. comparisons between strings of different character-types are not supported.
      * Any string, which satisfies the ``string`` concept is directly supported, thus it's possible to integrate your own types seamlessly.
+     * Strings with integral character-types are compared via ``std::memcmp`` and searched via ``std::memchr``
+     * (or ``std::find`` for wider characters), which the standard-libraries usually vectorize.
      *
      * ## Example
      *
@@ -96,7 +1017,8 @@ namespace mimicpp::matches::str
      *
      * #### Byte-String
      *
-     * Byte-Strings are element-wise lazily case-folded via ``std::toupper`` function.
+     * Byte-Strings are element-wise case-folded, by mapping the ascii lower-case letters onto their upper-case counterparts.
+     * This is independent of the current locale and all other characters are left untouched.
      *
      * #### Strings with other character-types
      *
@@ -105,6 +1027,13 @@ namespace mimicpp::matches::str
      *
      * Another, but yet experimental, possibility is to enable the \ref MIMICPP_CONFIG_EXPERIMENTAL_UNICODE_STR_MATCHER option.
      *
+     * ## Literal Patterns
+     *
+     * ``eq``, ``starts_with``, ``ends_with`` and ``contains`` additionally accept byte-string literals as template-argument
+     * (e.g. ``eq<"Hello">()``).
+     * These matchers don't store anything and their descriptions are built during compile-time.
+     * Short patterns are compared via a fully unrolled expression.
+     *
      *\{
      */
 
@@ -121,7 +1050,7 @@ namespace mimicpp::matches::str
             []<string T, typename Stored>(T&& target, Stored&& stored) {
                 detail::check_string_compatibility<T, Pattern>();
 
-                return std::ranges::equal(
+                return detail::string_equal(
                     detail::make_view(std::forward<T>(target)),
                     detail::make_view(std::forward<Stored>(stored)));
             },
@@ -139,17 +1068,22 @@ namespace mimicpp::matches::str
     [[nodiscard]]
     constexpr auto eq(Pattern&& pattern, [[maybe_unused]] const case_insensitive_t)
     {
+        using CaseFoldedPatternT = detail::CaseFoldedPattern<std::decay_t<Pattern>>;
+
         return PredicateMatcher{
-            []<case_foldable_string T, typename Stored>(T&& target, Stored&& stored) {
+            []<case_foldable_string T>(T&& target, const CaseFoldedPatternT& stored) {
                 detail::check_string_compatibility<T, Pattern>();
 
-                return std::ranges::equal(
-                    detail::make_case_folded_string(std::forward<T>(target)),
-                    detail::make_case_folded_string(std::forward<Stored>(stored)));
+                return stored.equals(std::forward<T>(target));
             },
             "is case-insensitively equal to {}",
             "is case-insensitively not equal to {}",
-            std::make_tuple(std::forward<Pattern>(pattern))};
+            std::make_tuple(
+                mimicpp::detail::arg_storage<
+                    CaseFoldedPatternT,
+                    std::identity,
+                    detail::describe_stored_pattern_fn>{
+                    CaseFoldedPatternT{std::forward<Pattern>(pattern)}})};
     }
 
     /**
@@ -165,12 +1099,9 @@ namespace mimicpp::matches::str
             []<string T, typename Stored>(T&& target, Stored&& stored) {
                 detail::check_string_compatibility<T, Pattern>();
 
-                auto patternView = detail::make_view(std::forward<Stored>(stored));
-                const auto [ignore, patternIter] = std::ranges::mismatch(
+                return detail::string_starts_with(
                     detail::make_view(std::forward<T>(target)),
-                    patternView);
-
-                return patternIter == std::ranges::end(patternView);
+                    detail::make_view(std::forward<Stored>(stored)));
             },
             "starts with {}",
             "starts not with {}",
@@ -182,24 +1113,26 @@ namespace mimicpp::matches::str
      * \tparam Pattern The string type.
      * \param pattern The pattern string.
      */
-    template <string Pattern>
+    template <case_foldable_string Pattern>
     [[nodiscard]]
     constexpr auto starts_with(Pattern&& pattern, [[maybe_unused]] const case_insensitive_t)
     {
+        using CaseFoldedPatternT = detail::CaseFoldedPattern<std::decay_t<Pattern>>;
+
         return PredicateMatcher{
-            []<string T, typename Stored>(T&& target, Stored&& stored) {
+            []<case_foldable_string T>(T&& target, const CaseFoldedPatternT& stored) {
                 detail::check_string_compatibility<T, Pattern>();
 
-                auto caseFoldedPattern = detail::make_case_folded_string(std::forward<Stored>(stored));
-                const auto [ignore, patternIter] = std::ranges::mismatch(
-                    detail::make_case_folded_string(std::forward<T>(target)),
-                    caseFoldedPattern);
-
-                return patternIter == std::ranges::end(caseFoldedPattern);
+                return stored.is_prefix_of(std::forward<T>(target));
             },
             "case-insensitively starts with {}",
             "case-insensitively starts not with {}",
-            std::make_tuple(std::forward<Pattern>(pattern))};
+            std::make_tuple(
+                mimicpp::detail::arg_storage<
+                    CaseFoldedPatternT,
+                    std::identity,
+                    detail::describe_stored_pattern_fn>{
+                    CaseFoldedPatternT{std::forward<Pattern>(pattern)}})};
     }
 
     /**
@@ -215,13 +1148,9 @@ namespace mimicpp::matches::str
             []<string T, typename Stored>(T&& target, Stored&& stored) {
                 detail::check_string_compatibility<T, Pattern>();
 
-                auto patternView = detail::make_view(std::forward<Stored>(stored))
-                                 | std::views::reverse;
-                const auto [ignore, patternIter] = std::ranges::mismatch(
-                    detail::make_view(std::forward<T>(target)) | std::views::reverse,
-                    patternView);
-
-                return patternIter == std::ranges::end(patternView);
+                return detail::string_ends_with(
+                    detail::make_view(std::forward<T>(target)),
+                    detail::make_view(std::forward<Stored>(stored)));
             },
             "ends with {}",
             "ends not with {}",
@@ -233,50 +1162,54 @@ namespace mimicpp::matches::str
      * \tparam Pattern The string type.
      * \param pattern The pattern string.
      */
-    template <string Pattern>
+    template <case_foldable_string Pattern>
     [[nodiscard]]
     constexpr auto ends_with(Pattern&& pattern, [[maybe_unused]] const case_insensitive_t)
     {
+        using CaseFoldedPatternT = detail::CaseFoldedPattern<std::decay_t<Pattern>>;
+
         return PredicateMatcher{
-            []<string T, typename Stored>(T&& target, Stored&& stored) {
+            []<case_foldable_string T>(T&& target, const CaseFoldedPatternT& stored) {
                 detail::check_string_compatibility<T, Pattern>();
 
-                auto caseFoldedPattern = detail::make_case_folded_string(std::forward<Stored>(stored))
-                                       | std::views::reverse;
-                const auto [ignore, patternIter] = std::ranges::mismatch(
-                    detail::make_case_folded_string(std::forward<T>(target)) | std::views::reverse,
-                    caseFoldedPattern);
-
-                return patternIter == std::ranges::end(caseFoldedPattern);
+                return stored.is_suffix_of(std::forward<T>(target));
             },
             "case-insensitively ends with {}",
             "case-insensitively ends not with {}",
-            std::make_tuple(std::forward<Pattern>(pattern))};
+            std::make_tuple(
+                mimicpp::detail::arg_storage<
+                    CaseFoldedPatternT,
+                    std::identity,
+                    detail::describe_stored_pattern_fn>{
+                    CaseFoldedPatternT{std::forward<Pattern>(pattern)}})};
     }
 
     /**
      * \brief Tests, whether the pattern string is part of the target string.
      * \tparam Pattern The string type.
      * \param pattern The pattern string.
+     * \details The search-table for the pattern is built once, thus long patterns are found in sub-linear time.
      */
     template <string Pattern>
     [[nodiscard]]
     constexpr auto contains(Pattern&& pattern)
     {
+        using SearchablePatternT = detail::SearchablePattern<std::decay_t<Pattern>>;
+
         return PredicateMatcher{
-            []<string T, typename Stored>(T&& target, Stored&& stored) {
+            []<string T>(T&& target, const SearchablePatternT& stored) {
                 detail::check_string_compatibility<T, Pattern>();
 
-                auto patternView = detail::make_view(std::forward<Stored>(stored));
-                return std::ranges::empty(patternView)
-                    || !std::ranges::empty(
-                           std::ranges::search(
-                               detail::make_view(std::forward<T>(target)),
-                               std::move(patternView)));
+                return stored.is_part_of(std::forward<T>(target));
             },
             "contains {}",
             "contains not {}",
-            std::make_tuple(std::forward<Pattern>(pattern))};
+            std::make_tuple(
+                mimicpp::detail::arg_storage<
+                    SearchablePatternT,
+                    std::identity,
+                    detail::describe_stored_pattern_fn>{
+                    SearchablePatternT{std::forward<Pattern>(pattern)}})};
     }
 
     /**
@@ -284,22 +1217,75 @@ namespace mimicpp::matches::str
      * \tparam Pattern The string type.
      * \param pattern The pattern string.
      */
-    template <string Pattern>
+    template <case_foldable_string Pattern>
     [[nodiscard]]
     constexpr auto contains(Pattern&& pattern, [[maybe_unused]] const case_insensitive_t)
     {
+        using CaseFoldedPatternT = detail::CaseFoldedPattern<std::decay_t<Pattern>>;
+
         return PredicateMatcher{
-            []<string T, typename Stored>(T&& target, Stored&& stored) {
+            []<case_foldable_string T>(T&& target, const CaseFoldedPatternT& stored) {
                 detail::check_string_compatibility<T, Pattern>();
 
-                auto patternView = detail::make_case_folded_string(std::forward<Stored>(stored));
-                auto targetView = detail::make_case_folded_string(std::forward<T>(target));
-                return std::ranges::empty(patternView)
-                    || !std::ranges::empty(std::ranges::search(targetView, patternView));
+                return stored.is_part_of(std::forward<T>(target));
             },
             "case-insensitively contains {}",
             "case-insensitively contains not {}",
-            std::make_tuple(std::forward<Pattern>(pattern))};
+            std::make_tuple(
+                mimicpp::detail::arg_storage<
+                    CaseFoldedPatternT,
+                    std::identity,
+                    detail::describe_stored_pattern_fn>{
+                    CaseFoldedPatternT{std::forward<Pattern>(pattern)}})};
+    }
+
+    /**
+     * \brief Tests, whether the target string compares equal to the given literal.
+     * \tparam pattern The pattern literal.
+     * \details The pattern and the description are fully determined during compile-time.
+     * \snippet Requirements.cpp matcher str literal
+     */
+    template <detail::FixedString pattern>
+    [[nodiscard]]
+    consteval auto eq() noexcept
+    {
+        return detail::LiteralStringMatcher<detail::literal_equal_fn, pattern, false>{};
+    }
+
+    /**
+     * \brief Tests, whether the target string starts with the given literal.
+     * \tparam pattern The pattern literal.
+     * \details The pattern and the description are fully determined during compile-time.
+     */
+    template <detail::FixedString pattern>
+    [[nodiscard]]
+    consteval auto starts_with() noexcept
+    {
+        return detail::LiteralStringMatcher<detail::literal_starts_with_fn, pattern, false>{};
+    }
+
+    /**
+     * \brief Tests, whether the target string ends with the given literal.
+     * \tparam pattern The pattern literal.
+     * \details The pattern and the description are fully determined during compile-time.
+     */
+    template <detail::FixedString pattern>
+    [[nodiscard]]
+    consteval auto ends_with() noexcept
+    {
+        return detail::LiteralStringMatcher<detail::literal_ends_with_fn, pattern, false>{};
+    }
+
+    /**
+     * \brief Tests, whether the given literal is part of the target string.
+     * \tparam pattern The pattern literal.
+     * \details The pattern, its search-table and the description are fully determined during compile-time.
+     */
+    template <detail::FixedString pattern>
+    [[nodiscard]]
+    consteval auto contains() noexcept
+    {
+        return detail::LiteralStringMatcher<detail::literal_contains_fn, pattern, false>{};
     }
 
     /**
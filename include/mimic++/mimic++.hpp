@@ -13,15 +13,20 @@
 
 #include "mimic++/Call.hpp"
 #include "mimic++/CallConvention.hpp"
+#include "mimic++/CallRecorder.hpp"
 #include "mimic++/Expectation.hpp"
 #include "mimic++/ExpectationBuilder.hpp"
+#include "mimic++/ExpectationTable.hpp"
+#include "mimic++/ExplicitInstantiation.hpp"
 #include "mimic++/InterfaceMock.hpp"
 #include "mimic++/Mock.hpp"
 #include "mimic++/ObjectWatcher.hpp"
 #include "mimic++/Printer.hpp"
+#include "mimic++/Replay.hpp"
 #include "mimic++/Reporter.hpp"
 #include "mimic++/Reports.hpp"
 #include "mimic++/Sequence.hpp"
+#include "mimic++/Spy.hpp"
 #include "mimic++/String.hpp"
 #include "mimic++/TypeTraits.hpp"
 #include "mimic++/Utility.hpp"
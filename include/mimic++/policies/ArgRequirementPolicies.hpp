@@ -49,19 +49,31 @@ namespace mimicpp::expectation_policies
     class ArgsRequirement
     {
     public:
+        /**
+         * \brief Determines, whether the description is built once during construction.
+         * \details That's only the case for matchers with a stable description.
+         * All other descriptions may refer to user data and are thus rebuilt on each request.
+         */
+        static constexpr bool cachesDescription = mimicpp::detail::has_stable_description<Matcher>::value;
+
         [[nodiscard]]
         explicit constexpr ArgsRequirement(
             Matcher matcher,
             MatchesStrategy matchesStrategy,
             DescribeStrategy describeStrategy)
             noexcept(
-                std::is_nothrow_move_constructible_v<Matcher>
+                !cachesDescription
+                && std::is_nothrow_move_constructible_v<Matcher>
                 && std::is_nothrow_move_constructible_v<MatchesStrategy>
                 && std::is_nothrow_move_constructible_v<DescribeStrategy>)
             : m_Matcher{std::move(matcher)},
               m_MatchesStrategy{std::move(matchesStrategy)},
               m_DescribeStrategy{std::move(describeStrategy)}
         {
+            if constexpr (cachesDescription)
+            {
+                m_Description = make_description();
+            }
         }
 
         [[nodiscard]]
@@ -87,18 +99,46 @@ namespace mimicpp::expectation_policies
         {
         }
 
+        /**
+         * \brief Returns the description of this requirement.
+         * \details Expectations query the description for each incoming call.
+         * Stable descriptions are therefore built just once (see ``cachesDescription``) and returned by reference.
+         * As they are never modified after construction, concurrent calls are safe.
+         */
         [[nodiscard]]
-        StringT describe() const
+        decltype(auto) describe() const
         {
-            return std::invoke(
-                m_DescribeStrategy,
-                detail::describe_hook::describe(m_Matcher));
+            if constexpr (cachesDescription)
+            {
+                return std::as_const(m_Description);
+            }
+            else
+            {
+                // The matcher is part of an expectation, which stays alive and unchanged while a cache is active.
+                if (detail::PrintCache* const cache = detail::PrintCacheScope::current())
+                {
+                    cache->register_owner(m_Matcher);
+                }
+
+                return make_description();
+            }
         }
 
     private:
+        using DescriptionT = std::conditional_t<cachesDescription, StringT, std::tuple<>>;
+
         Matcher m_Matcher;
         [[no_unique_address]] MatchesStrategy m_MatchesStrategy;
         [[no_unique_address]] DescribeStrategy m_DescribeStrategy;
+        [[no_unique_address]] DescriptionT m_Description{};
+
+        [[nodiscard]]
+        StringT make_description() const
+        {
+            return std::invoke(
+                m_DescribeStrategy,
+                detail::describe_hook::describe(m_Matcher));
+        }
     };
 }
 
@@ -112,11 +152,14 @@ namespace mimicpp::expect
             [[nodiscard]]
             StringT operator()(const StringViewT matcherDescription) const
             {
-                StringStreamT out{};
-                out << "expect: arg[" << index;
-                ((out << ", " << others), ...);
-                out << "] " << matcherDescription;
-                return std::move(out).str();
+                PrintBufferT buffer{};
+                PrintIteratorT out = format::format_to(
+                    PrintIteratorT{buffer},
+                    "expect: arg[{}",
+                    index);
+                ((out = format::format_to(std::move(out), ", {}", others)), ...);
+                format::format_to(std::move(out), "] {}", matcherDescription);
+                return mimicpp::detail::to_print_string(std::move(buffer));
             }
         };
 
@@ -125,9 +168,12 @@ namespace mimicpp::expect
             [[nodiscard]]
             StringT operator()(const StringViewT matcherDescription) const
             {
-                StringStreamT out{};
-                out << "expect: arg[all] " << matcherDescription;
-                return std::move(out).str();
+                PrintBufferT buffer{};
+                format::format_to(
+                    PrintIteratorT{buffer},
+                    "expect: arg[all] {}",
+                    matcherDescription);
+                return mimicpp::detail::to_print_string(std::move(buffer));
             }
         };
 
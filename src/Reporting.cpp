@@ -0,0 +1,15 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MIMICPP_CONFIG_COMPILED
+    #error "The mimicpp::compiled library must be built with MIMICPP_CONFIG_COMPILED defined."
+#endif
+
+// Emits the definitions of all non-template functions, which are otherwise just declared by the headers.
+#define MIMICPP_DETAIL_COMPILED_SOURCE
+
+#include "mimic++/Reporter.hpp"
+#include "mimic++/Reports.hpp"
+#include "mimic++/Stacktrace.hpp"
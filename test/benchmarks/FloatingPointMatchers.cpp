@@ -0,0 +1,98 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/matchers/FloatingPointMatchers.hpp"
+#include "mimic++/matchers/RangeMatchers.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace
+{
+    namespace matches = mimicpp::matches;
+    namespace range = mimicpp::matches::range;
+
+    // All expected elements share the same value, so that the scalar matchers can be applied via each_element as the
+    // baseline.
+    constexpr float expectedValue{42.f};
+    constexpr float absEpsilon{0.01f};
+    constexpr float relEpsilon{1e-5f};
+
+    struct Data
+    {
+        std::vector<float> expected;
+        std::vector<float> target;
+    };
+
+    // Each target element is the adjacent value of the expected element, thus each matcher must inspect all elements.
+    [[nodiscard]]
+    Data make_data(const std::size_t size)
+    {
+        return Data{
+            .expected = std::vector(size, expectedValue),
+            .target = std::vector(size, std::nextafter(expectedValue, std::numeric_limits<float>::infinity()))};
+    }
+
+    template <typename Matcher>
+    void run(benchmark::State& state, const Matcher& matcher, const std::vector<float>& target)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.matches(target));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void each_element_approx_abs(benchmark::State& state)
+    {
+        const auto [expected, target] = make_data(static_cast<std::size_t>(state.range(0)));
+        run(state, range::each_element(matches::approx_abs(expectedValue, absEpsilon)), target);
+    }
+
+    void eq_with_comparator(benchmark::State& state)
+    {
+        const auto [expected, target] = make_data(static_cast<std::size_t>(state.range(0)));
+        const auto matcher = range::eq(
+            expected,
+            [](const float lhs, const float rhs) { return std::abs(lhs - rhs) <= absEpsilon; });
+        run(state, matcher, target);
+    }
+
+    void approx_abs(benchmark::State& state)
+    {
+        const auto [expected, target] = make_data(static_cast<std::size_t>(state.range(0)));
+        run(state, range::approx_abs(expected, absEpsilon), target);
+    }
+
+    void each_element_approx_rel(benchmark::State& state)
+    {
+        const auto [expected, target] = make_data(static_cast<std::size_t>(state.range(0)));
+        run(state, range::each_element(matches::approx_rel(expectedValue, relEpsilon)), target);
+    }
+
+    void approx_rel(benchmark::State& state)
+    {
+        const auto [expected, target] = make_data(static_cast<std::size_t>(state.range(0)));
+        run(state, range::approx_rel(expected, relEpsilon), target);
+    }
+
+    void approx_ulp(benchmark::State& state)
+    {
+        const auto [expected, target] = make_data(static_cast<std::size_t>(state.range(0)));
+        run(state, range::approx_ulp(expected, 4u), target);
+    }
+}
+
+BENCHMARK(each_element_approx_abs)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(eq_with_comparator)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(approx_abs)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(each_element_approx_rel)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(approx_rel)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(approx_ulp)->Arg(1 << 10)->Arg(1 << 16);
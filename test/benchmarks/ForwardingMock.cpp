@@ -0,0 +1,70 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/Mock.hpp"
+#include "mimic++/matchers/GeneralMatchers.hpp"
+#include "mimic++/policies/ControlPolicies.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    // Wraps the bytes, so that the call-report doesn't print each single element.
+    // Otherwise, the printing would dominate the measurements.
+    struct Payload
+    {
+        std::vector<std::uint8_t> bytes;
+    };
+
+    template <typename MockT>
+    void by_value_lvalue(benchmark::State& state)
+    {
+        MockT mock{};
+        MIMICPP_SCOPED_EXPECTATION mock.expect_call(mimicpp::matches::_)
+            and mimicpp::expect::at_least(0u);
+
+        Payload payload{std::vector(static_cast<std::size_t>(state.range(0)), std::uint8_t{42})};
+        for ([[maybe_unused]] auto _ : state)
+        {
+            mock(payload);
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    }
+
+    template <typename MockT>
+    void by_value_const_lvalue(benchmark::State& state)
+    {
+        MockT mock{};
+        MIMICPP_SCOPED_EXPECTATION mock.expect_call(mimicpp::matches::_)
+            and mimicpp::expect::at_least(0u);
+
+        const Payload payload{std::vector(static_cast<std::size_t>(state.range(0)), std::uint8_t{42})};
+        for ([[maybe_unused]] auto _ : state)
+        {
+            mock(payload);
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    }
+}
+
+BENCHMARK_TEMPLATE(by_value_lvalue, mimicpp::Mock<void(Payload)>)
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(by_value_lvalue, mimicpp::ForwardingMock<void(Payload)>)
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 1 << 20);
+
+BENCHMARK_TEMPLATE(by_value_const_lvalue, mimicpp::Mock<void(Payload)>)
+    ->Arg(1 << 20);
+BENCHMARK_TEMPLATE(by_value_const_lvalue, mimicpp::ForwardingMock<void(Payload)>)
+    ->Arg(1 << 20);
@@ -0,0 +1,48 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/Printer.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace
+{
+    void print_int(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(mimicpp::print(42));
+        }
+    }
+
+    void print_string(benchmark::State& state)
+    {
+        const std::string value{"Hello, World!"};
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(mimicpp::print(value));
+        }
+    }
+
+    void print_vector(benchmark::State& state)
+    {
+        std::vector<int> values(static_cast<std::size_t>(state.range(0)));
+        std::iota(values.begin(), values.end(), 0);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(mimicpp::print(values));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(print_int);
+BENCHMARK(print_string);
+BENCHMARK(print_vector)->Arg(16)->Arg(10'000);
@@ -0,0 +1,83 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/matchers/RangeMatchers.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#ifdef MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS
+    #include <execution>
+#endif
+
+namespace
+{
+    namespace range = mimicpp::matches::range;
+
+    struct Data
+    {
+        std::vector<int> expected;
+        std::vector<int> target;
+    };
+
+    // The target is a shuffled copy of the expected range, thus each strategy must inspect all elements.
+    [[nodiscard]]
+    Data make_data(const std::size_t size)
+    {
+        Data data{};
+        data.expected.resize(size);
+        std::iota(data.expected.begin(), data.expected.end(), 0);
+
+        data.target = data.expected;
+        std::ranges::shuffle(data.target, std::mt19937{42u});
+
+        return data;
+    }
+
+    template <typename Strategy>
+    void unordered_eq(benchmark::State& state)
+    {
+        const auto [expected, target] = make_data(static_cast<std::size_t>(state.range(0)));
+        const auto matcher = range::unordered_eq(expected, Strategy{});
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.matches(target));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(unordered_eq<range::unordered_strategy::pairwise_t>)->Arg(1 << 10)->Arg(1 << 14);
+BENCHMARK(unordered_eq<range::unordered_strategy::sorted_t>)->Arg(1 << 10)->Arg(1 << 14)->Arg(100'000);
+BENCHMARK(unordered_eq<range::unordered_strategy::hashed_t>)->Arg(1 << 10)->Arg(1 << 14)->Arg(100'000);
+
+#ifdef MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS
+
+namespace
+{
+    template <typename Policy>
+    void each_element(benchmark::State& state, const Policy policy)
+    {
+        std::vector<float> samples(static_cast<std::size_t>(state.range(0)), 0.5f);
+        const auto matcher = range::each_element(policy, mimicpp::matches::le(1.f));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.matches(samples));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(each_element, seq, std::execution::seq)->Arg(1 << 20)->Arg(16 << 20);
+BENCHMARK_CAPTURE(each_element, par_unseq, std::execution::par_unseq)->Arg(1 << 20)->Arg(16 << 20);
+
+#endif
@@ -0,0 +1,47 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/matchers/GeneralMatchers.hpp"
+#include "mimic++/matchers/RegexMatchers.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <regex>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    namespace matches = mimicpp::matches;
+
+    constexpr std::string_view pattern{R"(request-\d+: (GET|POST) /[a-z/]+)"};
+    constexpr std::string_view target{"request-1337: POST /api/v1/users"};
+
+    // The common workaround, which compiles the expression during each call.
+    void predicate_regex(benchmark::State& state)
+    {
+        const auto matcher = matches::predicate([](const std::string_view str) {
+            return std::regex_match(str.cbegin(), str.cend(), std::regex{std::string{pattern}});
+        });
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.matches(target));
+        }
+    }
+
+    void str_regex(benchmark::State& state)
+    {
+        const auto matcher = matches::str::regex(pattern);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.matches(target));
+        }
+    }
+}
+
+BENCHMARK(predicate_regex);
+BENCHMARK(str_regex);
@@ -0,0 +1,81 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/InterfaceMock.hpp"
+#include "mimic++/Mock.hpp"
+#include "mimic++/policies/FinalizerPolicies.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace
+{
+    class Interface
+    {
+    public:
+        virtual ~Interface() = default;
+        virtual int compute(int value) = 0;
+    };
+
+    class Real final
+        : public Interface
+    {
+    public:
+        int compute(const int value) override
+        {
+            return value + 1;
+        }
+    };
+
+    class Derived final
+        : public Interface
+    {
+    public:
+        MOCK_METHOD(compute, int, (int));
+    };
+
+    void run(benchmark::State& state, Interface& obj)
+    {
+        int value{};
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(value = obj.compute(value));
+        }
+    }
+
+    void direct_call(benchmark::State& state)
+    {
+        const std::unique_ptr<Interface> real = std::make_unique<Real>();
+        run(state, *real);
+    }
+
+    void spy_pass_through(benchmark::State& state)
+    {
+        Real real{};
+        Derived mock{};
+        const mimicpp::ScopedSpy spy = mock.compute_.spy_on(
+            [&](const int value) { return real.compute(value); });
+
+        run(state, mock);
+    }
+
+    void spy_pass_through_with_unmatched_expectation(benchmark::State& state)
+    {
+        Real real{};
+        Derived mock{};
+        const mimicpp::ScopedSpy spy = mock.compute_.spy_on(
+            [&](const int value) { return real.compute(value); });
+        MIMICPP_SCOPED_EXPECTATION mock.compute_.expect_call(-1)
+            and mimicpp::expect::at_least(0u)
+            and mimicpp::finally::returns(0);
+
+        run(state, mock);
+    }
+}
+
+BENCHMARK(direct_call);
+BENCHMARK(spy_pass_through);
+BENCHMARK(spy_pass_through_with_unmatched_expectation);
@@ -0,0 +1,324 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/matchers/StringMatchers.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    namespace matches = mimicpp::matches;
+
+    constexpr std::string_view pattern{"mimic++ end of payload"};
+
+    // A payload, which frequently contains the first character of the pattern, but the full pattern just at the end.
+    [[nodiscard]]
+    std::string make_payload(const std::size_t size)
+    {
+        std::string payload(size, 'x');
+        for (std::size_t i{}; i < size; i += 64u)
+        {
+            payload[i] = 'm';
+        }
+        payload.replace(size - pattern.size(), pattern.size(), pattern);
+
+        return payload;
+    }
+
+    // A payload of pseudo-random words, which contains the pattern just at the end.
+    // In contrast to make_payload, the first character of the pattern occurs very frequently.
+    [[nodiscard]]
+    std::string make_text(const std::size_t size, const std::string_view textPattern)
+    {
+        std::string text(size, ' ');
+        std::uint32_t state{42u};
+        for (char& c : text)
+        {
+            state = state * 1664525u + 1013904223u;
+            if (const std::uint32_t value = (state >> 24u) % 32u;
+                value < 26u)
+            {
+                c = static_cast<char>('a' + value);
+            }
+        }
+        text.replace(size - textPattern.size(), textPattern.size(), textPattern);
+
+        return text;
+    }
+
+    constexpr std::string_view textPattern{"the quick brown fox jumps over the lazy dog and then rests a bit"};
+
+    void set_bytes_processed(benchmark::State& state)
+    {
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    }
+
+    // The generic algorithms, which were used by the matchers before.
+    void generic_contains(benchmark::State& state)
+    {
+        const std::string payload = make_payload(static_cast<std::size_t>(state.range(0)));
+        const std::string_view target{payload};
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(!std::ranges::empty(std::ranges::search(target, pattern)));
+        }
+
+        set_bytes_processed(state);
+    }
+
+    void contains(benchmark::State& state)
+    {
+        const std::string payload = make_payload(static_cast<std::size_t>(state.range(0)));
+        const std::string_view target{payload};
+        const auto matcher = matches::str::contains(pattern);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.matches(target));
+        }
+
+        set_bytes_processed(state);
+    }
+
+    void generic_contains_text(benchmark::State& state)
+    {
+        const std::string payload = make_text(static_cast<std::size_t>(state.range(0)), textPattern);
+        const std::string_view target{payload};
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(!std::ranges::empty(std::ranges::search(target, textPattern)));
+        }
+
+        set_bytes_processed(state);
+    }
+
+    void contains_text(benchmark::State& state)
+    {
+        const std::string payload = make_text(static_cast<std::size_t>(state.range(0)), textPattern);
+        const std::string_view target{payload};
+        const auto matcher = matches::str::contains(textPattern);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.matches(target));
+        }
+
+        set_bytes_processed(state);
+    }
+
+    // The lazily, via std::toupper folded views, which were used by the case-insensitive matchers before.
+    [[nodiscard]]
+    auto make_toupper_view(const std::string_view str)
+    {
+        return str
+             | std::views::transform([](const char c) {
+                   return static_cast<char>(
+                       static_cast<unsigned char>(std::toupper(c)));
+               });
+    }
+
+    void generic_case_insensitive_contains_text(benchmark::State& state)
+    {
+        const std::string payload = make_text(static_cast<std::size_t>(state.range(0)), textPattern);
+        const std::string_view target{payload};
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto foldedTarget = make_toupper_view(target);
+            auto foldedPattern = make_toupper_view(textPattern);
+            benchmark::DoNotOptimize(!std::ranges::empty(std::ranges::search(foldedTarget, foldedPattern)));
+        }
+
+        set_bytes_processed(state);
+    }
+
+    void case_insensitive_contains_text(benchmark::State& state)
+    {
+        const std::string payload = make_text(static_cast<std::size_t>(state.range(0)), textPattern);
+        const std::string_view target{payload};
+        const auto matcher = matches::str::contains(textPattern, mimicpp::case_insensitive);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.matches(target));
+        }
+
+        set_bytes_processed(state);
+    }
+
+    void generic_case_insensitive_eq(benchmark::State& state)
+    {
+        const std::string payload = make_text(static_cast<std::size_t>(state.range(0)), textPattern);
+        std::string other = payload;
+        std::ranges::transform(other, other.begin(), [](const char c) { return static_cast<char>(std::toupper(c)); });
+        const std::string_view target{payload};
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(std::ranges::equal(make_toupper_view(target), make_toupper_view(other)));
+        }
+
+        set_bytes_processed(state);
+    }
+
+    void case_insensitive_eq(benchmark::State& state)
+    {
+        const std::string payload = make_text(static_cast<std::size_t>(state.range(0)), textPattern);
+        std::string other = payload;
+        std::ranges::transform(other, other.begin(), [](const char c) { return static_cast<char>(std::toupper(c)); });
+        const std::string_view target{payload};
+        const auto matcher = matches::str::eq(other, mimicpp::case_insensitive);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.matches(target));
+        }
+
+        set_bytes_processed(state);
+    }
+
+    void generic_eq(benchmark::State& state)
+    {
+        const std::string payload = make_payload(static_cast<std::size_t>(state.range(0)));
+        const std::string other = payload;
+        const std::string_view target{payload};
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(std::ranges::equal(target, std::string_view{other}));
+        }
+
+        set_bytes_processed(state);
+    }
+
+    void eq(benchmark::State& state)
+    {
+        const std::string payload = make_payload(static_cast<std::size_t>(state.range(0)));
+        const std::string_view target{payload};
+        const auto matcher = matches::str::eq(payload);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.matches(target));
+        }
+
+        set_bytes_processed(state);
+    }
+
+    void generic_starts_with(benchmark::State& state)
+    {
+        const std::string payload = make_payload(static_cast<std::size_t>(state.range(0)));
+        const std::string prefix = payload.substr(0u, payload.size() / 2u);
+        const std::string_view target{payload};
+        const std::string_view prefixView{prefix};
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const auto [ignore, patternIter] = std::ranges::mismatch(target, prefixView);
+            benchmark::DoNotOptimize(patternIter == prefixView.cend());
+        }
+
+        set_bytes_processed(state);
+    }
+
+    void starts_with(benchmark::State& state)
+    {
+        const std::string payload = make_payload(static_cast<std::size_t>(state.range(0)));
+        const std::string_view target{payload};
+        const auto matcher = matches::str::starts_with(payload.substr(0u, payload.size() / 2u));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.matches(target));
+        }
+
+        set_bytes_processed(state);
+    }
+
+    void generic_ends_with(benchmark::State& state)
+    {
+        const std::string payload = make_payload(static_cast<std::size_t>(state.range(0)));
+        const std::string suffix = payload.substr(payload.size() / 2u);
+        const std::string_view target{payload};
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto reversedSuffix = std::string_view{suffix} | std::views::reverse;
+            const auto [ignore, patternIter] = std::ranges::mismatch(
+                target | std::views::reverse,
+                reversedSuffix);
+            benchmark::DoNotOptimize(patternIter == std::ranges::end(reversedSuffix));
+        }
+
+        set_bytes_processed(state);
+    }
+
+    void ends_with(benchmark::State& state)
+    {
+        const std::string payload = make_payload(static_cast<std::size_t>(state.range(0)));
+        const std::string_view target{payload};
+        const auto matcher = matches::str::ends_with(payload.substr(payload.size() / 2u));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.matches(target));
+        }
+
+        set_bytes_processed(state);
+    }
+
+    void short_eq(benchmark::State& state)
+    {
+        const std::string_view target{"Hello, World!"};
+        const auto matcher = matches::str::eq("Hello, World!");
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.matches(target));
+        }
+    }
+
+    void literal_eq(benchmark::State& state)
+    {
+        const std::string_view target{"Hello, World!"};
+        const auto matcher = matches::str::eq<"Hello, World!">();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.matches(target));
+        }
+    }
+
+    void short_eq_describe(benchmark::State& state)
+    {
+        const auto matcher = matches::str::eq("Hello, World!");
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.describe());
+        }
+    }
+
+    void literal_eq_describe(benchmark::State& state)
+    {
+        const auto matcher = matches::str::eq<"Hello, World!">();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(matcher.describe());
+        }
+    }
+}
+
+BENCHMARK(generic_contains)->Arg(1 << 20)->Arg(16 << 20);
+BENCHMARK(contains)->Arg(1 << 20)->Arg(16 << 20);
+BENCHMARK(generic_contains_text)->Arg(1 << 20)->Arg(16 << 20);
+BENCHMARK(contains_text)->Arg(1 << 20)->Arg(16 << 20);
+BENCHMARK(generic_case_insensitive_contains_text)->Arg(1 << 20)->Arg(16 << 20);
+BENCHMARK(case_insensitive_contains_text)->Arg(1 << 20)->Arg(16 << 20);
+BENCHMARK(generic_case_insensitive_eq)->Arg(1 << 20)->Arg(16 << 20);
+BENCHMARK(case_insensitive_eq)->Arg(1 << 20)->Arg(16 << 20);
+BENCHMARK(generic_eq)->Arg(1 << 20)->Arg(16 << 20);
+BENCHMARK(eq)->Arg(1 << 20)->Arg(16 << 20);
+BENCHMARK(generic_starts_with)->Arg(1 << 20)->Arg(16 << 20);
+BENCHMARK(starts_with)->Arg(1 << 20)->Arg(16 << 20);
+BENCHMARK(generic_ends_with)->Arg(1 << 20)->Arg(16 << 20);
+BENCHMARK(ends_with)->Arg(1 << 20)->Arg(16 << 20);
+BENCHMARK(short_eq);
+BENCHMARK(literal_eq);
+BENCHMARK(short_eq_describe);
+BENCHMARK(literal_eq_describe);
@@ -0,0 +1,53 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// This translation unit is not meant to be executed. It instantiates a large amount of distinct mocked signatures,
+// so that the build time of this target reflects the template instantiation cost of the framework.
+
+#include "mimic++/Mock.hpp"
+#include "mimic++/policies/FinalizerPolicies.hpp"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef MIMICPP_COMPILE_BENCHMARK_SIGNATURES
+    #define MIMICPP_COMPILE_BENCHMARK_SIGNATURES 1000
+#endif
+
+namespace
+{
+    // Each index introduces a new, non-printable type, which must be dispatched by the printer.
+    template <std::size_t index>
+    struct Tag
+    {
+        int value{};
+    };
+
+    template <std::size_t index>
+    int instantiate()
+    {
+        namespace finally = mimicpp::finally;
+        using mimicpp::matches::_;
+
+        mimicpp::Mock<int(Tag<index>, const std::string&, std::vector<int>)> mock{};
+        SCOPED_EXP mock.expect_call(_, _, _)
+            and finally::returns(static_cast<int>(index));
+
+        return mock(Tag<index>{}, "Hello, World!", {});
+    }
+
+    template <std::size_t... indices>
+    int instantiate_all([[maybe_unused]] const std::index_sequence<indices...>)
+    {
+        return (0 + ... + instantiate<indices>());
+    }
+}
+
+int run_compile_benchmark()
+{
+    return instantiate_all(std::make_index_sequence<MIMICPP_COMPILE_BENCHMARK_SIGNATURES>{});
+}
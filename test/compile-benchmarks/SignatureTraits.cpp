@@ -0,0 +1,78 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// This translation unit is not meant to be executed. It instantiates a large amount of overload-sets, whose signatures
+// cover all qualifications (and a non-default call-convention, if available), but doesn't invoke any of them.
+// Thus, the build time of this target mainly reflects the cost of the signature type-traits and the call-interfaces.
+// MIMICPP_COMPILE_BENCHMARK_SIGNATURES denotes the total amount of signatures, which is distributed over the overload-sets.
+
+#include "mimic++/CallConvention.hpp"
+#include "mimic++/Mock.hpp"
+
+#include <cstddef>
+#include <utility>
+
+#ifndef MIMICPP_COMPILE_BENCHMARK_SIGNATURES
+    #define MIMICPP_COMPILE_BENCHMARK_SIGNATURES 1000
+#endif
+
+#if defined(_MSC_VER) || (defined(__clang__) && !defined(__APPLE__))
+    #define CALL_CONVENTION __vectorcall
+#elif defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+    #define CALL_CONVENTION __attribute__((ms_abi))
+#endif
+
+#ifdef CALL_CONVENTION
+MIMICPP_REGISTER_CALL_CONVENTION(CALL_CONVENTION, compile_benchmark_call_convention);
+    #define SIGNATURES_PER_INDEX 8u
+#else
+    #define SIGNATURES_PER_INDEX 6u
+#endif
+
+namespace
+{
+    template <std::size_t index>
+    struct Tag
+    {
+        int value{};
+    };
+
+    template <std::size_t index>
+    std::size_t instantiate()
+    {
+        using T = Tag<index>;
+
+        mimicpp::Mock<
+            void(T),
+            void(T) const noexcept,
+            int(T, int) &,
+            int(T, int) const&,
+            int(T, int) && noexcept,
+            int(T, int) const&&>
+            mock{};
+
+#ifdef CALL_CONVENTION
+        mimicpp::Mock<
+            void CALL_CONVENTION(T, float),
+            int CALL_CONVENTION(T, float) const noexcept>
+            callConventionMock{};
+
+        return sizeof(mock) + sizeof(callConventionMock);
+#else
+        return sizeof(mock);
+#endif
+    }
+
+    template <std::size_t... indices>
+    std::size_t instantiate_all([[maybe_unused]] const std::index_sequence<indices...>)
+    {
+        return (0u + ... + instantiate<indices>());
+    }
+}
+
+std::size_t run_signature_traits_compile_benchmark()
+{
+    return instantiate_all(std::make_index_sequence<MIMICPP_COMPILE_BENCHMARK_SIGNATURES / SIGNATURES_PER_INDEX>{});
+}
@@ -0,0 +1,269 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/CallRecorder.hpp"
+#include "mimic++/InterfaceMock.hpp"
+#include "mimic++/Mock.hpp"
+#include "mimic++/matchers/GeneralMatchers.hpp"
+#include "mimic++/policies/ControlPolicies.hpp"
+#include "mimic++/policies/FinalizerPolicies.hpp"
+
+#include "TestReporter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+using namespace mimicpp;
+
+TEST_CASE(
+    "CallRecorder is a non-copyable, but movable type.",
+    "[mock][mock::recorder]")
+{
+    using RecorderT = CallRecorder<void(int)>;
+
+    STATIC_REQUIRE(!std::is_copy_constructible_v<RecorderT>);
+    STATIC_REQUIRE(!std::is_copy_assignable_v<RecorderT>);
+    STATIC_REQUIRE(std::is_nothrow_move_constructible_v<RecorderT>);
+    STATIC_REQUIRE(std::is_nothrow_move_assignable_v<RecorderT>);
+}
+
+TEST_CASE(
+    "CallRecorder transfers its log on move and can be reused after a new recorder is assigned.",
+    "[mock][mock::recorder]")
+{
+    ScopedReporter reporter{};
+    Mock<void(int)> mock{};
+    SCOPED_EXP mock.expect_call(matches::_)
+        and expect::at_least(0);
+
+    CallRecorder source = mock.record_calls();
+    mock(42);
+
+    CallRecorder target{std::move(source)};
+    mock(1337);
+    REQUIRE(std::ranges::equal(std::array{42, 1337}, target.column<0>()));
+
+    source = mock.record_calls();
+    mock(-1);
+    REQUIRE(std::ranges::equal(std::array{-1}, source.column<0>()));
+    REQUIRE(std::ranges::equal(std::array{42, 1337, -1}, target.column<0>()));
+
+    target = std::move(source);
+    mock(-2);
+    REQUIRE(std::ranges::equal(std::array{-1, -2}, target.column<0>()));
+}
+
+TEST_CASE(
+    "CallRecorder copies all args by default.",
+    "[mock][mock::recorder]")
+{
+    ScopedReporter reporter{};
+    Mock<void(int, const std::string&)> mock{};
+
+    const CallRecorder recorder = mock.record_calls();
+    STATIC_REQUIRE(std::same_as<std::span<const int>, decltype(recorder.column<0>())>);
+    STATIC_REQUIRE(std::same_as<std::span<const std::string>, decltype(recorder.column<1>())>);
+    REQUIRE(recorder.empty());
+
+    SCOPED_EXP mock.expect_call(matches::_, matches::_)
+        and expect::at_least(0);
+
+    mock(42, "Hello");
+    mock(1337, "World");
+
+    REQUIRE(2u == recorder.size());
+    REQUIRE(std::ranges::equal(std::array{42, 1337}, recorder.column<0>()));
+    REQUIRE(std::ranges::equal(std::array<std::string, 2u>{"Hello", "World"}, recorder.column<1>()));
+    REQUIRE(std::ranges::equal(std::array{std::this_thread::get_id(), std::this_thread::get_id()}, recorder.thread_ids()));
+    REQUIRE(2u == recorder.timestamps().size());
+    REQUIRE(std::ranges::is_sorted(recorder.timestamps()));
+}
+
+TEST_CASE(
+    "CallRecorder provides contiguous bool columns.",
+    "[mock][mock::recorder]")
+{
+    ScopedReporter reporter{};
+    Mock<void(bool, int)> mock{};
+    SCOPED_EXP mock.expect_call(matches::_, matches::_)
+        and expect::at_least(0);
+
+    CallRecorder recorder = mock.record_calls();
+    STATIC_REQUIRE(std::same_as<std::span<const bool>, decltype(recorder.column<0>())>);
+    REQUIRE(recorder.column<0>().empty());
+
+    // exceeds the initial capacity
+    for (int i{0}; i < 20; ++i)
+    {
+        mock(0 == i % 3, i);
+    }
+
+    REQUIRE(20u == recorder.size());
+    REQUIRE(std::ranges::equal(
+        std::views::iota(0, 20) | std::views::transform([](const int i) { return 0 == i % 3; }),
+        recorder.column<0>()));
+    REQUIRE(std::ranges::equal(std::views::iota(0, 20), recorder.column<1>()));
+
+    recorder.clear();
+    REQUIRE(recorder.column<0>().empty());
+
+    recorder.reserve(42u);
+    mock(true, 42);
+    REQUIRE(std::ranges::equal(std::array{true}, recorder.column<0>()));
+}
+
+TEST_CASE(
+    "CallRecorder applies the projection.",
+    "[mock][mock::recorder]")
+{
+    ScopedReporter reporter{};
+    Mock<void(int, const std::string&)> mock{};
+    SCOPED_EXP mock.expect_call(matches::_, matches::_)
+        and expect::at_least(0);
+
+    SECTION("When a single value is returned.")
+    {
+        const CallRecorder recorder = mock.record_calls(
+            [](const int value, const std::string& str) { return value + static_cast<int>(str.size()); });
+        STATIC_REQUIRE(std::same_as<std::span<const int>, decltype(recorder.column<0>())>);
+
+        mock(42, "Hello");
+        mock(1337, "");
+
+        REQUIRE(std::ranges::equal(std::array{47, 1337}, recorder.column<0>()));
+    }
+
+    SECTION("When a tuple is returned, each element forms its own column.")
+    {
+        const CallRecorder recorder = mock.record_calls(
+            [](const int value, const std::string& str) { return std::tuple{str.size(), value}; });
+        STATIC_REQUIRE(std::same_as<std::span<const std::size_t>, decltype(recorder.column<0>())>);
+        STATIC_REQUIRE(std::same_as<std::span<const int>, decltype(recorder.column<1>())>);
+
+        mock(42, "Hello");
+        mock(1337, "");
+
+        REQUIRE(std::ranges::equal(std::array<std::size_t, 2u>{5u, 0u}, recorder.column<0>()));
+        REQUIRE(std::ranges::equal(std::array{42, 1337}, recorder.column<1>()));
+    }
+}
+
+TEST_CASE(
+    "CallRecorder records calls, regardless whether they match.",
+    "[mock][mock::recorder]")
+{
+    ScopedReporter reporter{};
+    Mock<int(int)> mock{};
+    const CallRecorder recorder = mock.record_calls();
+
+    REQUIRE_THROWS_AS(
+        mock(42),
+        NoMatchError);
+
+    REQUIRE(1u == recorder.size());
+    REQUIRE(42 == recorder.column<0>().front());
+}
+
+TEST_CASE(
+    "CallRecorder can be attached to specific overloads.",
+    "[mock][mock::recorder]")
+{
+    ScopedReporter reporter{};
+    Mock<void(int), int(std::string) const> mock{};
+
+    const CallRecorder intRecorder = mock.record_calls();
+    const CallRecorder strRecorder = mock.record_calls<int(std::string) const>();
+
+    SCOPED_EXP mock.expect_call(matches::_)
+        and expect::at_least(0);
+    SCOPED_EXP std::as_const(mock).expect_call(matches::_)
+        and expect::at_least(0)
+        and finally::returns(42);
+
+    mock(1337);
+    REQUIRE(42 == std::as_const(mock)("Hello, World!"));
+
+    REQUIRE(std::ranges::equal(std::array{1337}, intRecorder.column<0>()));
+    REQUIRE(std::ranges::equal(std::array<std::string, 1u>{"Hello, World!"}, strRecorder.column<0>()));
+}
+
+TEST_CASE(
+    "CallRecorder stops recording, when destroyed.",
+    "[mock][mock::recorder]")
+{
+    ScopedReporter reporter{};
+    Mock<void(int)> mock{};
+    SCOPED_EXP mock.expect_call(matches::_)
+        and expect::at_least(0);
+
+    std::optional<CallRecorder<void(int)>> first{mock.record_calls()};
+    const CallRecorder second = mock.record_calls();
+
+    mock(1);
+    first.reset();
+    mock(2);
+
+    REQUIRE(std::ranges::equal(std::array{1, 2}, second.column<0>()));
+}
+
+TEST_CASE(
+    "CallRecorder can be cleared.",
+    "[mock][mock::recorder]")
+{
+    ScopedReporter reporter{};
+    Mock<void(int)> mock{};
+    SCOPED_EXP mock.expect_call(matches::_)
+        and expect::at_least(0);
+
+    CallRecorder recorder = mock.record_calls();
+    recorder.reserve(42u);
+
+    mock(1);
+    recorder.clear();
+    REQUIRE(recorder.empty());
+    REQUIRE(recorder.thread_ids().empty());
+    REQUIRE(recorder.timestamps().empty());
+
+    mock(2);
+    REQUIRE(std::ranges::equal(std::array{2}, recorder.column<0>()));
+}
+
+TEST_CASE(
+    "CallRecorder can be attached to interface mock methods.",
+    "[mock][mock::recorder]")
+{
+    class Interface
+    {
+    public:
+        virtual ~Interface() = default;
+        virtual void foo(int) = 0;
+    };
+
+    class Derived
+        : public Interface
+    {
+    public:
+        MIMICPP_MOCK_METHOD(foo, void, (int));
+    };
+
+    ScopedReporter reporter{};
+    Derived mock{};
+    SCOPED_EXP mock.foo_.expect_call(matches::_)
+        and expect::at_least(0);
+
+    const CallRecorder recorder = mock.foo_.record_calls();
+
+    Interface& base = mock;
+    base.foo(42);
+
+    REQUIRE(std::ranges::equal(std::array{42}, recorder.column<0>()));
+}
@@ -17,6 +17,7 @@
 #include <optional>
 #include <ranges>
 #include <source_location>
+#include <vector>
 
 namespace
 {
@@ -968,3 +969,72 @@ TEST_CASE(
         REQUIRE(42 == collection->handle_call(call));
     }
 }
+
+namespace
+{
+    // builds its description from a temporary matcher, whose storage is reused by the other instances
+    struct TemporaryDescriptionMatcher
+    {
+        std::vector<int> expected;
+
+        [[nodiscard]]
+        bool matches(const std::vector<int>& target) const
+        {
+            return expected == target;
+        }
+
+        [[nodiscard]]
+        mimicpp::StringT describe() const
+        {
+            return mimicpp::StringT{mimicpp::matches::eq(std::vector<int>{expected}).describe()};
+        }
+    };
+}
+
+TEST_CASE(
+    "ExpectationCollection never reports stale descriptions of temporary matchers.",
+    "[expectation]")
+{
+    namespace expect = mimicpp::expect;
+    using SignatureT = void(const std::vector<int>&);
+    using CollectionT = mimicpp::ExpectationCollection<SignatureT>;
+    using CallInfoT = mimicpp::call::info_for_signature_t<SignatureT>;
+
+    auto collection = std::make_shared<CollectionT>();
+
+    ScopedReporter reporter{};
+
+    mimicpp::ScopedExpectation exp1 = mimicpp::detail::make_expectation_builder(collection)
+                                   && expect::times(0, 1)
+                                   && expect::arg<0>(TemporaryDescriptionMatcher{{1}});
+    mimicpp::ScopedExpectation exp2 = mimicpp::detail::make_expectation_builder(collection)
+                                   && expect::times(0, 1)
+                                   && expect::arg<0>(TemporaryDescriptionMatcher{{2}});
+
+    const std::vector value{42};
+    const CallInfoT call{
+        .args = {std::cref(value)},
+        .fromCategory = mimicpp::ValueCategory::any,
+        .fromConstness = mimicpp::Constness::any};
+
+    REQUIRE_THROWS_AS(
+        collection->handle_call(call),
+        NoMatchError);
+    REQUIRE_THAT(
+        reporter.no_match_reports(),
+        Catch::Matchers::SizeIs(2));
+
+    std::vector<mimicpp::StringT> descriptions{};
+    for (const auto& [callReport, matchReport] : reporter.no_match_reports())
+    {
+        for (const auto& expectationReport : matchReport.expectationReports)
+        {
+            descriptions.emplace_back(expectationReport.description.value_or(""));
+        }
+    }
+
+    REQUIRE_THAT(
+        descriptions,
+        Catch::Matchers::VectorContains(mimicpp::StringT{"expect: arg[0] == { 1 }"})
+            && Catch::Matchers::VectorContains(mimicpp::StringT{"expect: arg[0] == { 2 }"}));
+}
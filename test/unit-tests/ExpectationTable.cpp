@@ -0,0 +1,218 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/ExpectationTable.hpp"
+#include "mimic++/Mock.hpp"
+
+#include "TestReporter.hpp"
+
+#include <concepts>
+#include <functional>
+#include <map>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    struct unordered
+    {
+        int value{};
+
+        [[nodiscard]]
+        friend bool operator==(const unordered&, const unordered&) = default;
+    };
+}
+
+TEMPLATE_TEST_CASE_SIG(
+    "TableExpectation selects the lookup strategy depending on the parameter types.",
+    "[expectation][expectation::table]",
+    ((auto expected, typename Signature), expected, Signature),
+    (mimicpp::detail::table_lookup::hashed, void()),
+    (mimicpp::detail::table_lookup::hashed, void(int)),
+    (mimicpp::detail::table_lookup::hashed, void(const std::string&, int&&)),
+    (mimicpp::detail::table_lookup::sorted, void(std::vector<int>)),
+    (mimicpp::detail::table_lookup::sorted, void(int, const std::vector<int>&)),
+    (mimicpp::detail::table_lookup::linear, void(unordered)),
+    (mimicpp::detail::table_lookup::linear, void(int, unordered)))
+{
+    STATIC_REQUIRE(expected == mimicpp::detail::table_traits_for<Signature>::lookup);
+}
+
+TEST_CASE(
+    "Mock::expect_each accepts various row types.",
+    "[expectation][expectation::table]")
+{
+    using mimicpp::table_rows_for;
+
+    STATIC_REQUIRE(table_rows_for<std::map<int, int>, int(int)>);
+    STATIC_REQUIRE(table_rows_for<std::vector<std::pair<int, int>>, int(int)>);
+    STATIC_REQUIRE(table_rows_for<std::vector<std::tuple<std::tuple<int, int>, int>>, int(int, int)>);
+    STATIC_REQUIRE(table_rows_for<std::vector<std::pair<std::pair<int, std::string>, int>>, int(int, const std::string&)>);
+
+    STATIC_REQUIRE(!table_rows_for<std::vector<int>, int(int)>);
+    STATIC_REQUIRE(!table_rows_for<std::vector<std::pair<std::string, int>>, int(int)>);
+    STATIC_REQUIRE(!table_rows_for<std::vector<std::tuple<int, int, int>>, int(int)>);
+}
+
+TEMPLATE_TEST_CASE(
+    "Mock::expect_each behaves like one expectation per row.",
+    "[expectation][expectation::table]",
+    int,
+    std::vector<int>,
+    unordered)
+{
+    using mimicpp::Mock;
+    namespace expect = mimicpp::expect;
+
+    const auto makeArg = [](const int i) {
+        if constexpr (std::same_as<int, TestType>)
+        {
+            return i;
+        }
+        else if constexpr (std::same_as<unordered, TestType>)
+        {
+            return unordered{i};
+        }
+        else
+        {
+            return std::vector{i, i};
+        }
+    };
+
+    std::vector<std::pair<TestType, int>> rows{};
+    for (const int i : std::views::iota(0, 42))
+    {
+        rows.emplace_back(makeArg(i), -i);
+    }
+
+    ScopedReporter reporter{};
+    Mock<int(const TestType&)> mock{};
+
+    SECTION("Each row is matched exactly once by default.")
+    {
+        const mimicpp::ScopedExpectation expectation = mock.expect_each(rows);
+
+        for (const int i : std::views::iota(0, 42) | std::views::reverse)
+        {
+            CHECK(!expectation.is_satisfied());
+            REQUIRE(-i == mock(makeArg(i)));
+        }
+
+        REQUIRE(expectation.is_satisfied());
+        REQUIRE_THAT(
+            reporter.full_match_reports(),
+            Catch::Matchers::SizeIs(42));
+
+        REQUIRE_THROWS_AS(
+            mock(makeArg(0)),
+            NonApplicableMatchError);
+        REQUIRE_THAT(
+            reporter.inapplicable_match_reports(),
+            Catch::Matchers::SizeIs(1));
+    }
+
+    SECTION("Calls with unknown args are reported as no-match.")
+    {
+        const mimicpp::ScopedExpectation expectation = mock.expect_each(rows, expect::at_least(0));
+
+        REQUIRE_THROWS_AS(
+            mock(makeArg(1337)),
+            NoMatchError);
+        REQUIRE_THAT(
+            reporter.no_match_reports(),
+            Catch::Matchers::SizeIs(1));
+        REQUIRE(expectation.is_satisfied());
+    }
+
+    SECTION("Times are accounted per row.")
+    {
+        std::optional<mimicpp::ScopedExpectation> expectation{
+            mock.expect_each(rows, expect::twice())};
+
+        REQUIRE(0 == mock(makeArg(0)));
+        REQUIRE(0 == mock(makeArg(0)));
+        REQUIRE(-1 == mock(makeArg(1)));
+        REQUIRE(!expectation->is_satisfied());
+
+        expectation.reset();
+        REQUIRE_THAT(
+            reporter.unfulfilled_expectations(),
+            Catch::Matchers::SizeIs(1));
+        REQUIRE(
+            reporter.unfulfilled_expectations().front().timesDescription
+            == "1 out of 42 row(s) are satisfied, each row expects between 2 and 2 match(es)");
+    }
+}
+
+TEST_CASE(
+    "Mock::expect_each prefers the latest non-saturated row, if multiple rows have equal args.",
+    "[expectation][expectation::table]")
+{
+    ScopedReporter reporter{};
+    mimicpp::Mock<int(int, int)> mock{};
+
+    const std::vector<std::tuple<std::tuple<int, int>, int>> rows{
+        {{1, 2}, 1},
+        {{1, 3}, 2},
+        {{1, 2}, 3}
+    };
+    const mimicpp::ScopedExpectation expectation = mock.expect_each(rows);
+
+    REQUIRE(3 == mock(1, 2));
+    REQUIRE(1 == mock(1, 2));
+    REQUIRE(2 == mock(1, 3));
+    REQUIRE(expectation.is_satisfied());
+}
+
+TEST_CASE(
+    "Mock::expect_each supports actions as row values.",
+    "[expectation][expectation::table]")
+{
+    using SignatureT = void(int&);
+    using CallInfoT = mimicpp::call::info_for_signature_t<SignatureT>;
+    using ActionT = std::function<void(const CallInfoT&)>;
+
+    ScopedReporter reporter{};
+    mimicpp::Mock<SignatureT> mock{};
+
+    const std::vector<std::pair<int, ActionT>> rows{
+        {1, [](const CallInfoT& info) { std::get<0>(info.args).get() = 42; }},
+        {2, [](const CallInfoT& info) { std::get<0>(info.args).get() = 1337; }}
+    };
+    const mimicpp::ScopedExpectation expectation = mock.expect_each(rows);
+
+    int value{1};
+    mock(value);
+    REQUIRE(42 == value);
+
+    value = 2;
+    mock(value);
+    REQUIRE(1337 == value);
+}
+
+TEST_CASE(
+    "Mock::expect_each respects the qualification of the overload.",
+    "[expectation][expectation::table]")
+{
+    ScopedReporter reporter{};
+    mimicpp::Mock<int(int) &, int(int) &&> mock{};
+
+    const std::map<int, int> rows{
+        {1, 1},
+        {2, 2}
+    };
+    const mimicpp::ScopedExpectation expectation = std::move(mock).expect_each(rows);
+
+    REQUIRE_THROWS_AS(
+        mock(1),
+        NoMatchError);
+    REQUIRE(1 == std::move(mock)(1));
+    REQUIRE(2 == std::move(mock)(2));
+    REQUIRE(expectation.is_satisfied());
+}
@@ -5,6 +5,7 @@
 
 #include "mimic++/Mock.hpp"
 #include "mimic++/policies/FinalizerPolicies.hpp"
+#include "mimic++/policies/SideEffectPolicies.hpp"
 
 #include "TestReporter.hpp"
 #include "TestTypes.hpp"
@@ -915,3 +916,142 @@ TEST_CASE(
         mock(1337);
     }
 }
+
+TEMPLATE_TEST_CASE(
+    "ForwardingMock is a non-copyable, but movable and default-constructible type.",
+    "[mock][mock::forwarding]",
+    void(std::string),
+    void(std::string) const,
+    void(std::string) &,
+    void(std::string) const&,
+    void(std::string) &&,
+    void(std::string) const&&,
+    void(std::string) noexcept,
+    void(std::string) const noexcept,
+    void(std::string) & noexcept,
+    void(std::string) const& noexcept,
+    void(std::string) && noexcept,
+    void(std::string) const&& noexcept)
+{
+    using MockT = ForwardingMock<TestType>;
+
+    STATIC_REQUIRE(!std::is_copy_constructible_v<MockT>);
+    STATIC_REQUIRE(!std::is_copy_assignable_v<MockT>);
+
+    STATIC_REQUIRE(std::is_move_constructible_v<MockT>);
+    STATIC_REQUIRE(std::is_move_assignable_v<MockT>);
+    STATIC_REQUIRE(std::is_default_constructible_v<MockT>);
+
+    STATIC_REQUIRE(std::is_nothrow_move_constructible_v<MockT>);
+    STATIC_REQUIRE(std::is_nothrow_move_assignable_v<MockT>);
+}
+
+namespace
+{
+    class CopyCounter
+    {
+    public:
+        inline static int copies{};
+
+        int value{};
+
+        [[nodiscard]]
+        explicit(false) CopyCounter(const int v) noexcept
+            : value{v}
+        {
+        }
+
+        CopyCounter(const CopyCounter& other) noexcept
+            : value{other.value}
+        {
+            ++copies;
+        }
+
+        CopyCounter& operator=(const CopyCounter&) = default;
+        CopyCounter(CopyCounter&&) = default;
+        CopyCounter& operator=(CopyCounter&&) = default;
+
+        [[nodiscard]]
+        friend bool operator==(const CopyCounter&, const CopyCounter&) = default;
+    };
+}
+
+TEST_CASE(
+    "ForwardingMock binds by-value params directly, if possible.",
+    "[mock][mock::forwarding]")
+{
+    ScopedReporter reporter{};
+    ForwardingMock<int(CopyCounter)> mock{};
+
+    CopyCounter::copies = 0;
+    const CopyCounter* addr{};
+    const ScopedExpectation expectation = mock.expect_call(matches::_)
+                                       && then::apply_arg<0>([&](const CopyCounter& arg) { addr = &arg; })
+                                       && finally::returns(42);
+
+    SECTION("When a non-const lvalue is given.")
+    {
+        CopyCounter arg{1337};
+        REQUIRE(42 == mock(arg));
+        REQUIRE(&arg == addr);
+        REQUIRE(0 == CopyCounter::copies);
+    }
+
+    SECTION("When an rvalue is given.")
+    {
+        CopyCounter arg{1337};
+        REQUIRE(42 == mock(std::move(arg)));
+        REQUIRE(&arg == addr);
+        REQUIRE(0 == CopyCounter::copies);
+    }
+
+    SECTION("When a const lvalue is given, a copy is made.")
+    {
+        const CopyCounter arg{1337};
+        REQUIRE(42 == mock(arg));
+        REQUIRE(&arg != addr);
+        REQUIRE(1 == CopyCounter::copies);
+    }
+
+    SECTION("When a convertible arg is given, a temporary is made.")
+    {
+        REQUIRE(42 == mock(1337));
+        REQUIRE(0 == CopyCounter::copies);
+    }
+}
+
+TEST_CASE(
+    "ForwardingMock accepts the same by-value args as Mock.",
+    "[mock][mock::forwarding]")
+{
+    STATIC_REQUIRE(std::invocable<ForwardingMock<void(std::vector<int>)>&, std::vector<int>>);
+    STATIC_REQUIRE(std::invocable<ForwardingMock<void(std::vector<int>)>&, const std::vector<int>&>);
+
+    // std::vector has an explicit size-constructor
+    STATIC_REQUIRE(!std::invocable<Mock<void(std::vector<int>)>&, int>);
+    STATIC_REQUIRE(!std::invocable<ForwardingMock<void(std::vector<int>)>&, int>);
+}
+
+TEST_CASE(
+    "ForwardingMock behaves like Mock for all other kinds of params.",
+    "[mock][mock::forwarding]")
+{
+    ScopedReporter reporter{};
+
+    ForwardingMock<
+        void(const std::string&, int&),
+        double(int) const>
+        mock{};
+
+    int out{};
+    const ScopedExpectation firstExpectation = mock.expect_call("Hello, World!", matches::_)
+                                            && then::apply_arg<1>([](int& arg) { arg = 42; });
+    const ScopedExpectation secondExpectation = mock.expect_call(1337)
+                                             && finally::returns(4.2);
+
+    mock("Hello, World!", out);
+    REQUIRE(42 == out);
+    REQUIRE(4.2 == std::as_const(mock)(1337));
+    REQUIRE(firstExpectation.is_satisfied());
+    REQUIRE(secondExpectation.is_satisfied());
+}
@@ -5,8 +5,16 @@
 
 #include "mimic++/Printer.hpp"
 
+#include <array>
+#include <forward_list>
+#include <limits>
+#include <numeric>
+#include <optional>
 #include <ranges>
 #include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
 
 using namespace mimicpp;
 
@@ -215,6 +223,25 @@ struct format::formatter<FormatAndCustomPrintable, Char>
     }
 };
 
+TEMPLATE_TEST_CASE_SIG(
+    "detail::printer_kind_v selects the printer with the highest precedence.",
+    "[print]",
+    ((detail::printer_kind expected, typename T), expected, T),
+    (detail::printer_kind::custom, CustomPrintable),
+    (detail::printer_kind::custom, const CustomPrintable&),
+    (detail::printer_kind::custom, CustomAndInternalPrintable&),
+    (detail::printer_kind::custom, FormatAndCustomPrintable),
+    (detail::printer_kind::internal, InternalPrintable),
+    (detail::printer_kind::internal, const std::string&),
+    (detail::printer_kind::internal, int),
+    (detail::printer_kind::range, std::vector<int>&),
+    (detail::printer_kind::formattable, FormatPrintable),
+    (detail::printer_kind::formattable, double),
+    (detail::printer_kind::unprintable, NonPrintable))
+{
+    STATIC_REQUIRE(expected == detail::printer_kind_v<T>);
+}
+
 TEST_CASE(
     "print selects the best option to print a given value.",
     "[print]")
@@ -614,6 +641,49 @@ TEST_CASE(
     }
 }
 
+TEMPLATE_TEST_CASE(
+    "print prints integers like the {} format.",
+    "[print]",
+    short,
+    unsigned short,
+    int,
+    unsigned int,
+    long long,
+    unsigned long long)
+{
+    const auto value = GENERATE(
+        std::numeric_limits<TestType>::min(),
+        TestType{0},
+        TestType{42},
+        std::numeric_limits<TestType>::max());
+    CAPTURE(value);
+
+    REQUIRE_THAT(
+        print(value),
+        Catch::Matchers::Equals(format::format("{}", value)));
+
+    PrintBufferT buffer{};
+    print(PrintIteratorT{buffer}, value);
+    REQUIRE_THAT(
+        detail::to_print_string(std::move(buffer)),
+        Catch::Matchers::Equals(format::format("{}", value)));
+}
+
+TEST_CASE(
+    "print appends to the given print buffer.",
+    "[print]")
+{
+    PrintBufferT buffer{};
+    PrintIteratorT out{buffer};
+    out = print(std::move(out), std::vector{1, 2, 3});
+    out = print(std::move(out), std::string{"Hello, World!"});
+    print(std::move(out), std::optional<int>{});
+
+    REQUIRE_THAT(
+        detail::to_print_string(std::move(buffer)),
+        Catch::Matchers::Equals("{ 1, 2, 3 }\"Hello, World!\"nullopt"));
+}
+
 TEST_CASE(
     "ValueCategory is formattable.",
     "[print]")
@@ -761,3 +831,237 @@ TEMPLATE_TEST_CASE(
         std::move(out).str(),
         Catch::Matchers::Equals(expected));
 }
+
+namespace
+{
+    class LimitedRange
+        : public std::vector<int>
+    {
+    public:
+        using std::vector<int>::vector;
+    };
+
+    class ScopedPrintLimits
+    {
+    public:
+        explicit ScopedPrintLimits(const PrintLimits limits)
+            : m_Previous{print_limits()}
+        {
+            set_print_limits(limits);
+        }
+
+        ~ScopedPrintLimits()
+        {
+            set_print_limits(m_Previous);
+        }
+
+        ScopedPrintLimits(const ScopedPrintLimits&) = delete;
+        ScopedPrintLimits& operator=(const ScopedPrintLimits&) = delete;
+
+    private:
+        PrintLimits m_Previous;
+    };
+}
+
+template <>
+struct custom::print_limits_for<LimitedRange>
+{
+    static constexpr PrintLimits value{.maxElements = 2u};
+};
+
+TEST_CASE(
+    "print elides range elements beyond the limit.",
+    "[print]")
+{
+    const ScopedPrintLimits limits{PrintLimits{.maxElements = 3u}};
+
+    SECTION("When sized range exceeds the limit, the remaining count is printed.")
+    {
+        std::vector<int> values(1'000'000u);
+        std::iota(values.begin(), values.end(), 1);
+
+        REQUIRE_THAT(
+            print(values),
+            Catch::Matchers::Equals("{ 1, 2, 3, ... (999997 more) }"));
+    }
+
+    SECTION("When non-sized range exceeds the limit, the remaining count is unknown.")
+    {
+        const std::forward_list list{1, 2, 3, 4};
+
+        REQUIRE_THAT(
+            print(list),
+            Catch::Matchers::Equals("{ 1, 2, 3, ... }"));
+    }
+
+    SECTION("When range does not exceed the limit, all elements are printed.")
+    {
+        REQUIRE_THAT(
+            print(std::vector{1, 2, 3}),
+            Catch::Matchers::Equals("{ 1, 2, 3 }"));
+    }
+
+    SECTION("When infinite range is given, the iteration stops at the limit.")
+    {
+        REQUIRE_THAT(
+            print(std::views::iota(0)),
+            Catch::Matchers::Equals("{ 0, 1, 2, ... }"));
+    }
+
+    SECTION("When tuple exceeds the limit, the remaining count is printed.")
+    {
+        REQUIRE_THAT(
+            print(std::tuple{1, 2, 3, 4, 5}),
+            Catch::Matchers::Equals("{ 1, 2, 3, ... (2 more) }"));
+    }
+
+    SECTION("When tuple is empty, nothing is elided.")
+    {
+        REQUIRE_THAT(
+            print(std::tuple{}),
+            Catch::Matchers::Equals("{  }"));
+
+        const ScopedPrintLimits noElements{PrintLimits{.maxElements = 0u}};
+        REQUIRE_THAT(
+            print(std::tuple{}),
+            Catch::Matchers::Equals("{  }"));
+    }
+
+    SECTION("When type has custom limits, they are preferred.")
+    {
+        REQUIRE_THAT(
+            print(LimitedRange{1, 2, 3, 4}),
+            Catch::Matchers::Equals("{ 1, 2, ... (2 more) }"));
+    }
+}
+
+TEST_CASE(
+    "print elides string characters beyond the limit.",
+    "[print]")
+{
+    const ScopedPrintLimits limits{PrintLimits{.maxStringLength = 5u}};
+
+    REQUIRE_THAT(
+        print(std::string{"Hello, World!"}),
+        Catch::Matchers::Equals("\"Hello\" ... (8 more)"));
+    REQUIRE_THAT(
+        print("Hello"),
+        Catch::Matchers::Equals("\"Hello\""));
+    REQUIRE_THAT(
+        print(std::u8string{u8"Hello, World!"}),
+        Catch::Matchers::Equals("u8\"0x48, 0x65, 0x6c, 0x6c, 0x6f\" ... (8 more)"));
+}
+
+TEST_CASE(
+    "print elides ranges and tuples nested deeper than the limit.",
+    "[print]")
+{
+    const ScopedPrintLimits limits{PrintLimits{.maxDepth = 2u}};
+
+    const std::vector<std::vector<std::vector<int>>> nested{
+        {{1, 2}, {3}},
+        {}
+    };
+    REQUIRE_THAT(
+        print(nested),
+        Catch::Matchers::Equals("{ { { ... }, { ... } }, {  } }"));
+
+    REQUIRE_THAT(
+        print(std::tuple{1, std::tuple{2, std::vector{3}}}),
+        Catch::Matchers::Equals("{ 1, { 2, { ... } } }"));
+
+    REQUIRE_THAT(
+        print(std::vector<std::vector<int>>{{4}}),
+        Catch::Matchers::Equals("{ { 4 } }"));
+}
+
+TEST_CASE(
+    "detail::PrintCache prints each object just once.",
+    "[print]")
+{
+    using PrinterT = custom::Printer<CustomPrintable>;
+    PrinterT::printCallCounter = 0;
+
+    detail::PrintCache cache{};
+    const CustomPrintable first{};
+    const CustomPrintable second{};
+
+    REQUIRE_THAT(
+        cache.print(first),
+        Catch::Matchers::Equals("CustomPrintable"));
+    REQUIRE_THAT(
+        cache.print(first),
+        Catch::Matchers::Equals("CustomPrintable"));
+    REQUIRE(1 == PrinterT::printCallCounter);
+
+    REQUIRE_THAT(
+        cache.print(second),
+        Catch::Matchers::Equals("CustomPrintable"));
+    REQUIRE(2 == PrinterT::printCallCounter);
+
+    SECTION("References are identified by the referred object.")
+    {
+        const std::vector<CustomPrintable> values(1u);
+
+        REQUIRE_THAT(
+            cache.print(std::views::all(values)),
+            Catch::Matchers::Equals("{ CustomPrintable }"));
+        REQUIRE_THAT(
+            cache.print(std::views::all(values)),
+            Catch::Matchers::Equals("{ CustomPrintable }"));
+        REQUIRE(3 == PrinterT::printCallCounter);
+
+        // the referred object is the same, but the printed type differs
+        REQUIRE_THAT(
+            cache.print(values),
+            Catch::Matchers::Equals("{ CustomPrintable }"));
+        REQUIRE(4 == PrinterT::printCallCounter);
+    }
+}
+
+TEST_CASE(
+    "detail::PrintCache owns all sub-objects of registered owners.",
+    "[print]")
+{
+    struct Owner
+    {
+        int first{};
+        int second{};
+    };
+
+    const std::array<Owner, 3u> owners{};
+
+    detail::PrintCache cache{};
+    REQUIRE(!cache.owns(owners[1]));
+
+    cache.register_owner(owners[1]);
+    REQUIRE(cache.owns(owners[1]));
+    REQUIRE(cache.owns(owners[1].first));
+    REQUIRE(cache.owns(owners[1].second));
+    REQUIRE(!cache.owns(owners[0]));
+    REQUIRE(!cache.owns(owners[0].second));
+    REQUIRE(!cache.owns(owners[2]));
+    REQUIRE(!cache.owns(owners[2].first));
+}
+
+TEST_CASE(
+    "detail::PrintCacheScope activates a cache during its lifetime.",
+    "[print]")
+{
+    REQUIRE(!detail::PrintCacheScope::current());
+
+    {
+        const detail::PrintCacheScope outer{};
+        detail::PrintCache* const cache = detail::PrintCacheScope::current();
+        REQUIRE(cache);
+
+        {
+            const detail::PrintCacheScope inner{};
+            REQUIRE(cache == detail::PrintCacheScope::current());
+        }
+
+        REQUIRE(cache == detail::PrintCacheScope::current());
+    }
+
+    REQUIRE(!detail::PrintCacheScope::current());
+}
@@ -0,0 +1,380 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/Mock.hpp"
+#include "mimic++/Replay.hpp"
+#include "mimic++/matchers/GeneralMatchers.hpp"
+#include "mimic++/policies/ControlPolicies.hpp"
+
+#include "TestReporter.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    enum class Color : std::uint8_t
+    {
+        red,
+        green
+    };
+
+    struct Point
+    {
+        int x{};
+        int y{};
+
+        [[nodiscard]]
+        friend bool operator==(const Point&, const Point&) = default;
+    };
+
+    struct NotSerializable
+    {
+        [[nodiscard]]
+        friend bool operator==(const NotSerializable&, const NotSerializable&) = default;
+    };
+}
+
+template <>
+struct mimicpp::custom::Serializer<Point>
+{
+    static void write(std::ostream& out, const Point& value)
+    {
+        out << value.x << ' ' << value.y << ' ';
+    }
+
+    [[nodiscard]]
+    static Point read(std::istream& in)
+    {
+        Point value{};
+        in >> value.x >> value.y;
+        in.ignore(1);
+        return value;
+    }
+};
+
+TEMPLATE_TEST_CASE_SIG(
+    "replayable_signature determines, whether all params and the return type are serializable.",
+    "[replay]",
+    ((bool expected, typename Signature), expected, Signature),
+    (true, void()),
+    (true, int(float, Color)),
+    (true, std::string(const std::vector<int>&, std::optional<std::string>)),
+    (true, std::pair<int, bool>(std::tuple<char, double>&&)),
+    (true, Point(Point)),
+    (false, NotSerializable()),
+    (false, void(NotSerializable)),
+    (false, void(std::vector<NotSerializable>)),
+    (false, void(int*)))
+{
+    STATIC_REQUIRE(expected == mimicpp::replayable_signature<Signature>);
+}
+
+TEST_CASE(
+    "CallTape can be written and read.",
+    "[replay]")
+{
+    using TapeT = mimicpp::CallTape<std::optional<std::string>(int, const std::vector<Color>&, Point, std::pair<bool, double>)>;
+
+    TapeT tape{};
+    tape.record({42, {Color::red, Color::green}, {1, 2}, {true, 4.2}}, "Hello, World!");
+    tape.record({-1, {}, {-3, 4}, {false, -.5}}, std::nullopt);
+    tape.record({1337, {Color::green}, {}, {}}, "");
+
+    std::stringstream stream{};
+    tape.write(stream);
+
+    const TapeT other = TapeT::read(stream);
+    REQUIRE(tape.rows() == other.rows());
+}
+
+TEST_CASE(
+    "CallTape::read rejects malformed data.",
+    "[replay]")
+{
+    using TapeT = mimicpp::CallTape<int(int)>;
+
+    SECTION("When the magic doesn't match.")
+    {
+        std::stringstream stream{"Hello, World!"};
+        REQUIRE_THROWS_AS(
+            TapeT::read(stream),
+            std::runtime_error);
+    }
+
+    SECTION("When the signature doesn't match.")
+    {
+        std::stringstream stream{};
+        mimicpp::CallTape<int(int, int)>{}.write(stream);
+
+        REQUIRE_THROWS_AS(
+            TapeT::read(stream),
+            std::runtime_error);
+    }
+
+    SECTION("When the data is truncated.")
+    {
+        TapeT tape{};
+        tape.record({42}, 1337);
+
+        std::stringstream stream{};
+        tape.write(stream);
+        std::string data = std::move(stream).str();
+        data.pop_back();
+
+        std::stringstream truncated{data};
+        REQUIRE_THROWS_AS(
+            TapeT::read(truncated),
+            std::runtime_error);
+    }
+}
+
+TEST_CASE(
+    "CallTape::read rejects corrupt sizes without allocating them in advance.",
+    "[replay]")
+{
+    // magic, version and the arg count precede the row count
+    constexpr std::size_t rowCountOffset{8u + 4u + 8u};
+    constexpr std::uint64_t corruptSize{std::numeric_limits<std::uint64_t>::max() / 2u};
+
+    const auto corrupt = [&](std::string data, const std::size_t offset) {
+        std::memcpy(data.data() + offset, &corruptSize, sizeof(corruptSize));
+        return std::stringstream{std::move(data)};
+    };
+
+    SECTION("When the row count is corrupt.")
+    {
+        using TapeT = mimicpp::CallTape<int(int)>;
+        TapeT tape{};
+        tape.record({42}, 1337);
+
+        std::stringstream stream{};
+        tape.write(stream);
+
+        std::stringstream corrupted = corrupt(std::move(stream).str(), rowCountOffset);
+        REQUIRE_THROWS_AS(
+            TapeT::read(corrupted),
+            std::runtime_error);
+    }
+
+    SECTION("When the row count of rows without data is corrupt.")
+    {
+        using TapeT = mimicpp::CallTape<void()>;
+        TapeT tape{};
+        tape.record({}, {});
+
+        std::stringstream stream{};
+        tape.write(stream);
+
+        std::stringstream corrupted = corrupt(std::move(stream).str(), rowCountOffset);
+        REQUIRE_THROWS_AS(
+            TapeT::read(corrupted),
+            std::runtime_error);
+    }
+
+    SECTION("When the row count exceeds the remaining data.")
+    {
+        using TapeT = mimicpp::CallTape<int(int)>;
+        TapeT tape{};
+        tape.record({42}, 1337);
+
+        std::stringstream stream{};
+        tape.write(stream);
+        std::string data = std::move(stream).str();
+        constexpr std::uint64_t forgedCount{2u};
+        std::memcpy(data.data() + rowCountOffset, &forgedCount, sizeof(forgedCount));
+
+        std::stringstream forged{std::move(data)};
+        REQUIRE_THROWS_AS(
+            TapeT::read(forged),
+            std::runtime_error);
+    }
+
+    SECTION("When a vector size of elements without data is corrupt.")
+    {
+        using TapeT = mimicpp::CallTape<void(std::vector<std::tuple<>>)>;
+        TapeT tape{};
+        tape.record({std::vector<std::tuple<>>(3u)}, {});
+
+        std::stringstream stream{};
+        tape.write(stream);
+
+        std::stringstream corrupted = corrupt(std::move(stream).str(), rowCountOffset + 8u);
+        REQUIRE_THROWS_AS(
+            TapeT::read(corrupted),
+            std::runtime_error);
+    }
+
+    SECTION("When a string size is corrupt.")
+    {
+        using TapeT = mimicpp::CallTape<int(std::string)>;
+        TapeT tape{};
+        tape.record({"Hello, World!"}, 1337);
+
+        std::stringstream stream{};
+        tape.write(stream);
+
+        std::stringstream corrupted = corrupt(std::move(stream).str(), rowCountOffset + 8u);
+        REQUIRE_THROWS_AS(
+            TapeT::read(corrupted),
+            std::runtime_error);
+    }
+
+    SECTION("When a vector size is corrupt.")
+    {
+        using TapeT = mimicpp::CallTape<int(std::vector<int>)>;
+        TapeT tape{};
+        tape.record({std::vector{1, 2, 3}}, 1337);
+
+        std::stringstream stream{};
+        tape.write(stream);
+
+        std::stringstream corrupted = corrupt(std::move(stream).str(), rowCountOffset + 8u);
+        REQUIRE_THROWS_AS(
+            TapeT::read(corrupted),
+            std::runtime_error);
+    }
+}
+
+TEST_CASE(
+    "CallTape::read rejects invalid bools.",
+    "[replay]")
+{
+    // magic, version, the arg count and the row count precede the first row
+    constexpr std::size_t firstRowOffset{8u + 4u + 8u + 8u};
+    constexpr char invalidBool{2};
+
+    SECTION("When a bool is corrupt.")
+    {
+        using TapeT = mimicpp::CallTape<int(bool)>;
+        TapeT tape{};
+        tape.record({true}, 1337);
+
+        std::stringstream stream{};
+        tape.write(stream);
+        std::string data = std::move(stream).str();
+        data[firstRowOffset] = invalidBool;
+
+        std::stringstream corrupted{std::move(data)};
+        REQUIRE_THROWS_AS(
+            TapeT::read(corrupted),
+            std::runtime_error);
+    }
+
+    SECTION("When the flag of an optional is corrupt.")
+    {
+        using TapeT = mimicpp::CallTape<int(std::optional<int>)>;
+        TapeT tape{};
+        tape.record({std::nullopt}, 1337);
+
+        std::stringstream stream{};
+        tape.write(stream);
+        std::string data = std::move(stream).str();
+        data[firstRowOffset] = invalidBool;
+
+        std::stringstream corrupted{std::move(data)};
+        REQUIRE_THROWS_AS(
+            TapeT::read(corrupted),
+            std::runtime_error);
+    }
+}
+
+TEST_CASE(
+    "finally::record_to forwards the call and records it.",
+    "[replay]")
+{
+    namespace expect = mimicpp::expect;
+    namespace finally = mimicpp::finally;
+    namespace matches = mimicpp::matches;
+
+    ScopedReporter reporter{};
+
+    SECTION("When return type is non-void.")
+    {
+        mimicpp::CallTape<int(std::string, int)> tape{};
+        mimicpp::Mock<int(std::string, int)> mock{};
+        SCOPED_EXP mock.expect_call(matches::_, matches::_)
+            and expect::at_least(0)
+            and finally::record_to(tape, [](std::string& str, const int value) {
+                   // modifications aren't recorded
+                   str.clear();
+                   return value * 2;
+               });
+
+        REQUIRE(84 == mock("Hello", 42));
+        REQUIRE(-2 == mock("World", -1));
+
+        REQUIRE(
+            std::vector{
+                std::pair{std::tuple{std::string{"Hello"}, 42}, 84},
+                std::pair{std::tuple{std::string{"World"}, -1}, -2}}
+            == tape.rows());
+    }
+
+    SECTION("When return type is void.")
+    {
+        mimicpp::CallTape<void(int)> tape{};
+        mimicpp::Mock<void(int)> mock{};
+        int sum{};
+        SCOPED_EXP mock.expect_call(matches::_)
+            and expect::at_least(0)
+            and finally::record_to(tape, [&](const int value) { sum += value; });
+
+        mock(42);
+        mock(1337);
+
+        REQUIRE(42 + 1337 == sum);
+        REQUIRE(2u == tape.size());
+    }
+
+    SECTION("When the function throws, nothing is recorded.")
+    {
+        struct Exception
+        {
+        };
+
+        mimicpp::CallTape<int(int)> tape{};
+        mimicpp::Mock<int(int)> mock{};
+        SCOPED_EXP mock.expect_call(matches::_)
+            and finally::record_to(tape, [](int) -> int { throw Exception{}; });
+
+        REQUIRE_THROWS_AS(
+            mock(42),
+            Exception);
+        REQUIRE(tape.empty());
+    }
+}
+
+TEST_CASE(
+    "CallTape::replay_rows answers equal calls in order of recording.",
+    "[replay]")
+{
+    ScopedReporter reporter{};
+
+    mimicpp::CallTape<int(int)> tape{};
+    tape.record({1}, 1);
+    tape.record({2}, 2);
+    tape.record({1}, 3);
+
+    mimicpp::Mock<int(int)> mock{};
+    const mimicpp::ScopedExpectation expectation = mock.expect_each(tape.replay_rows());
+
+    REQUIRE(1 == mock(1));
+    REQUIRE(3 == mock(1));
+    REQUIRE(2 == mock(2));
+    REQUIRE(expectation.is_satisfied());
+
+    REQUIRE_THROWS_AS(
+        mock(1),
+        NonApplicableMatchError);
+}
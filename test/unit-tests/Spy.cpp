@@ -0,0 +1,239 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/InterfaceMock.hpp"
+#include "mimic++/Mock.hpp"
+#include "mimic++/Spy.hpp"
+#include "mimic++/policies/ControlPolicies.hpp"
+#include "mimic++/policies/FinalizerPolicies.hpp"
+
+#include "TestReporter.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+using namespace mimicpp;
+
+TEST_CASE(
+    "ScopedSpy is a non-copyable, but movable type.",
+    "[mock][mock::spy]")
+{
+    using SpyT = ScopedSpy<void(int)>;
+
+    STATIC_REQUIRE(!std::is_copy_constructible_v<SpyT>);
+    STATIC_REQUIRE(!std::is_copy_assignable_v<SpyT>);
+    STATIC_REQUIRE(std::is_nothrow_move_constructible_v<SpyT>);
+    STATIC_REQUIRE(std::is_nothrow_move_assignable_v<SpyT>);
+}
+
+TEST_CASE(
+    "spy_target_for determines, whether a function can serve the given signature.",
+    "[mock][mock::spy]")
+{
+    using FunT = int (*)(int);
+
+    STATIC_REQUIRE(spy_target_for<FunT, int(int)>);
+    STATIC_REQUIRE(spy_target_for<FunT, long(int)>);
+    STATIC_REQUIRE(spy_target_for<FunT, void(int)>);
+    STATIC_REQUIRE(!spy_target_for<FunT, std::string(int)>);
+    STATIC_REQUIRE(!spy_target_for<FunT, int(std::string)>);
+    STATIC_REQUIRE(!spy_target_for<FunT, int(int, int)>);
+}
+
+TEST_CASE(
+    "Spies forward unmatched calls to the installed function.",
+    "[mock][mock::spy]")
+{
+    ScopedReporter reporter{};
+    Mock<int(int)> mock{};
+
+    int calls{};
+    const ScopedSpy spy = mock.spy_on([&](const int value) {
+        ++calls;
+        return 2 * value;
+    });
+
+    SECTION("When no expectation exists.")
+    {
+        REQUIRE(2 == mock(1));
+        REQUIRE(84 == mock(42));
+        REQUIRE(2 == calls);
+    }
+
+    SECTION("When no expectation matches.")
+    {
+        SCOPED_EXP mock.expect_call(42)
+            and finally::returns(-1);
+
+        REQUIRE(6 == mock(3));
+        REQUIRE(1 == calls);
+
+        REQUIRE(-1 == mock(42));
+        REQUIRE(1 == calls);
+    }
+
+    SECTION("But not, when a matching expectation is saturated.")
+    {
+        SCOPED_EXP mock.expect_call(42)
+            and finally::returns(-1);
+        REQUIRE(-1 == mock(42));
+
+        REQUIRE_THROWS_AS(
+            mock(42),
+            NonApplicableMatchError);
+        REQUIRE(0 == calls);
+        REQUIRE_THAT(
+            reporter.inapplicable_match_reports(),
+            Catch::Matchers::SizeIs(1));
+    }
+
+    REQUIRE_THAT(
+        reporter.no_match_reports(),
+        Catch::Matchers::IsEmpty());
+}
+
+TEST_CASE(
+    "Spies are uninstalled, when the ScopedSpy goes out of scope.",
+    "[mock][mock::spy]")
+{
+    ScopedReporter reporter{};
+    Mock<int(int)> mock{};
+
+    std::optional<ScopedSpy<int(int)>> spy{
+        mock.spy_on([](const int value) { return value; })};
+    REQUIRE(42 == mock(42));
+
+    spy.reset();
+    REQUIRE_THROWS_AS(
+        mock(42),
+        NoMatchError);
+
+    spy.emplace(mock.spy_on([](const int value) { return -value; }));
+    REQUIRE(-42 == mock(42));
+}
+
+TEST_CASE(
+    "Spies forward the params with their original value category.",
+    "[mock][mock::spy]")
+{
+    ScopedReporter reporter{};
+    Mock<void(std::unique_ptr<int>, int&)> mock{};
+
+    std::unique_ptr<int> target{};
+    const ScopedSpy spy = mock.spy_on([&](std::unique_ptr<int>&& ptr, int& out) {
+        out = *ptr;
+        target = std::move(ptr);
+    });
+
+    int out{};
+    mock(std::make_unique<int>(42), out);
+    REQUIRE(42 == out);
+    REQUIRE(target);
+    REQUIRE(42 == *target);
+}
+
+TEST_CASE(
+    "Spies can be installed for each overload of a mock.",
+    "[mock][mock::spy]")
+{
+    ScopedReporter reporter{};
+    Mock<int(int), std::string(std::string) const> mock{};
+
+    const ScopedSpy intSpy = mock.spy_on([](const int value) { return value + 1; });
+    const ScopedSpy stringSpy = mock.spy_on<std::string(std::string) const>(
+        [](std::string str) { return str + "!"; });
+
+    REQUIRE(43 == mock(42));
+    REQUIRE("Hello!" == std::as_const(mock)(std::string{"Hello"}));
+}
+
+TEST_CASE(
+    "Spies of ForwardingMock never move from the caller's arguments.",
+    "[mock][mock::spy]")
+{
+    using MoveOnly = std::unique_ptr<int>;
+
+    STATIC_REQUIRE(spy_target_for<void (*)(MoveOnly), void(MoveOnly)>);
+    STATIC_REQUIRE(!detail::borrowing_spy_target_for<void (*)(MoveOnly), void(MoveOnly)>);
+    STATIC_REQUIRE(detail::borrowing_spy_target_for<void (*)(const MoveOnly&), void(MoveOnly)>);
+    STATIC_REQUIRE(detail::borrowing_spy_target_for<void (*)(MoveOnly), void(MoveOnly&&)>);
+
+    ScopedReporter reporter{};
+    ForwardingMock<std::string(std::string)> mock{};
+
+    std::string received{};
+    const ScopedSpy spy = mock.spy_on([&](std::string str) {
+        received = std::move(str);
+        return received + "!";
+    });
+
+    SECTION("When an lvalue is passed.")
+    {
+        std::string arg{"Hello, World! This string is long enough to be allocated."};
+
+        REQUIRE(arg + "!" == mock(arg));
+        REQUIRE(arg == received);
+        REQUIRE("Hello, World! This string is long enough to be allocated." == arg);
+    }
+
+    SECTION("When an rvalue is passed.")
+    {
+        REQUIRE("Hello!" == mock(std::string{"Hello"}));
+        REQUIRE("Hello" == received);
+    }
+}
+
+TEST_CASE(
+    "Spies can forward methods of interface-mocks to a real object.",
+    "[mock][mock::spy][mock::interface]")
+{
+    class Interface
+    {
+    public:
+        virtual ~Interface() = default;
+        virtual int foo(int) = 0;
+        virtual std::string bar() const = 0;
+    };
+
+    class Real
+        : public Interface
+    {
+    public:
+        int foo(const int value) override
+        {
+            return value * value;
+        }
+
+        std::string bar() const override
+        {
+            return "real";
+        }
+    };
+
+    class Derived
+        : public Interface
+    {
+    public:
+        MOCK_METHOD(foo, int, (int));
+        MOCK_METHOD(bar, std::string, (), const);
+    };
+
+    ScopedReporter reporter{};
+    Real real{};
+    Derived mock{};
+    Interface& obj = mock;
+
+    const ScopedSpy fooSpy = mock.foo_.spy_on([&](const int value) { return real.foo(value); });
+    const ScopedSpy barSpy = mock.bar_.spy_on([&] { return real.bar(); });
+
+    SCOPED_EXP mock.foo_.expect_call(3)
+        and finally::returns(-1);
+
+    REQUIRE(4 == obj.foo(2));
+    REQUIRE(-1 == obj.foo(3));
+    REQUIRE("real" == obj.bar());
+}
@@ -453,6 +453,25 @@ TEMPLATE_TEST_CASE_SIG(
     STATIC_REQUIRE(expected == case_foldable_string<const T&&>);
 }
 
+TEST_CASE(
+    "string_case_fold_converter<char> folds just ascii letters, independent of the current locale.",
+    "[string]")
+{
+    STATIC_REQUIRE('A' == string_case_fold_converter<char>::fold('a'));
+    STATIC_REQUIRE('Z' == string_case_fold_converter<char>::fold('z'));
+    STATIC_REQUIRE('A' == string_case_fold_converter<char>::fold('A'));
+    STATIC_REQUIRE('@' == string_case_fold_converter<char>::fold('@'));
+    STATIC_REQUIRE('`' == string_case_fold_converter<char>::fold('`'));
+    STATIC_REQUIRE('{' == string_case_fold_converter<char>::fold('{'));
+
+    const int value = GENERATE(range(0, 256));
+    const auto c = static_cast<char>(value);
+    const char expected = ('a' <= c && c <= 'z')
+                            ? static_cast<char>(c - 'a' + 'A')
+                            : c;
+    REQUIRE(expected == string_case_fold_converter<char>::fold(c));
+}
+
 #else
 
 TEMPLATE_TEST_CASE(
@@ -654,4 +673,47 @@ TEMPLATE_TEST_CASE_SIG(
     STATIC_REQUIRE(expected == case_foldable_string<const T&&>);
 }
 
+TEST_CASE(
+    "Unicode string_case_fold_converters never split code-points.",
+    "[string]")
+{
+    SECTION("For utf8-strings.")
+    {
+        // 1 + 2 + 3 code-units
+        constexpr std::u8string_view str{u8"a\u00DF\u20AC"};
+        using ConverterT = string_case_fold_converter<char8_t>;
+
+        STATIC_REQUIRE(0u == ConverterT::code_point_boundary(str, 0u));
+        STATIC_REQUIRE(1u == ConverterT::code_point_boundary(str, 1u));
+        STATIC_REQUIRE(1u == ConverterT::code_point_boundary(str, 2u));
+        STATIC_REQUIRE(3u == ConverterT::code_point_boundary(str, 3u));
+        STATIC_REQUIRE(3u == ConverterT::code_point_boundary(str, 4u));
+        STATIC_REQUIRE(3u == ConverterT::code_point_boundary(str, 5u));
+        STATIC_REQUIRE(6u == ConverterT::code_point_boundary(str, 6u));
+    }
+
+    SECTION("For utf16-strings.")
+    {
+        // 1 + 2 + 1 code-units
+        constexpr std::u16string_view str{u"a\U0001F600b"};
+        using ConverterT = string_case_fold_converter<char16_t>;
+
+        STATIC_REQUIRE(0u == ConverterT::code_point_boundary(str, 0u));
+        STATIC_REQUIRE(1u == ConverterT::code_point_boundary(str, 1u));
+        STATIC_REQUIRE(1u == ConverterT::code_point_boundary(str, 2u));
+        STATIC_REQUIRE(3u == ConverterT::code_point_boundary(str, 3u));
+        STATIC_REQUIRE(4u == ConverterT::code_point_boundary(str, 4u));
+    }
+
+    SECTION("For utf32-strings.")
+    {
+        constexpr std::u32string_view str{U"a\U0001F600b"};
+        using ConverterT = string_case_fold_converter<char32_t>;
+
+        STATIC_REQUIRE(0u == ConverterT::code_point_boundary(str, 0u));
+        STATIC_REQUIRE(1u == ConverterT::code_point_boundary(str, 1u));
+        STATIC_REQUIRE(2u == ConverterT::code_point_boundary(str, 2u));
+    }
+}
+
 #endif
@@ -5,6 +5,11 @@
 
 #include "mimic++/matchers/FloatingPointMatchers.hpp"
 
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
 using namespace mimicpp;
 
 TEMPLATE_TEST_CASE(
@@ -260,3 +265,227 @@ TEMPLATE_TEST_CASE(
         matches::approx_rel(T{4.2}, epsilon),
         std::runtime_error);
 }
+
+TEMPLATE_TEST_CASE(
+    "matches::range::approx_abs compares floating-point ranges element-wise.",
+    "[matcher][matcher::range]",
+    float,
+    double,
+    long double)
+{
+    using T = TestType;
+
+    // exceeds a single block and leaves a remainder
+    std::vector<T> expected(150u);
+    for (std::size_t i{}; i < expected.size(); ++i)
+    {
+        expected[i] = static_cast<T>(i) / T{10};
+    }
+    // exactly representable by all floating-point types
+    const auto matcher = matches::range::approx_abs(expected, T{0.0625});
+
+    REQUIRE_THAT(
+        matcher.describe(),
+        Catch::Matchers::StartsWith("elements are approximately { 0, 0.1, ")
+            && Catch::Matchers::EndsWith(" } +- 0.0625"));
+
+    std::vector target{expected};
+    REQUIRE(matcher.matches(target));
+
+    const std::size_t index = GENERATE(0u, 63u, 64u, 127u, 128u, 149u);
+    CAPTURE(index);
+
+    SECTION("When an element is within the tolerance.")
+    {
+        target[index] += T{0.04};
+        REQUIRE(matcher.matches(target));
+    }
+
+    SECTION("When an element exceeds the tolerance.")
+    {
+        target[index] -= T{0.07};
+        REQUIRE(!matcher.matches(target));
+    }
+
+    SECTION("When an element is not a number.")
+    {
+        target[index] = std::numeric_limits<T>::quiet_NaN();
+        REQUIRE(!matcher.matches(target));
+    }
+
+    SECTION("When an element is infinite.")
+    {
+        target[index] = std::numeric_limits<T>::infinity();
+        REQUIRE(!matcher.matches(target));
+    }
+
+    SECTION("When the sizes differ.")
+    {
+        target.pop_back();
+        REQUIRE(!matcher.matches(target));
+    }
+}
+
+TEMPLATE_TEST_CASE(
+    "matches::range::approx_abs throws std::runtime_error, when invalid epsilon is given.",
+    "[matcher][matcher::range]",
+    float,
+    double,
+    long double)
+{
+    using T = TestType;
+
+    const auto epsilon = GENERATE(
+        std::numeric_limits<T>::quiet_NaN(),
+        std::numeric_limits<T>::infinity(),
+        T{0},
+        T{-4.2});
+    INFO("Epsilon: " << epsilon);
+
+    REQUIRE_THROWS_AS(
+        matches::range::approx_abs(std::vector<T>{}, epsilon),
+        std::runtime_error);
+}
+
+TEMPLATE_TEST_CASE(
+    "matches::range::approx_rel compares floating-point ranges element-wise with a scaled epsilon.",
+    "[matcher][matcher::range]",
+    float,
+    double,
+    long double)
+{
+    using T = TestType;
+
+    std::vector<T> expected(150u, T{1000});
+    // exactly representable by all floating-point types
+    const auto matcher = matches::range::approx_rel(expected, T{0.0078125});
+
+    REQUIRE_THAT(
+        matcher.describe(),
+        Catch::Matchers::StartsWith("elements are approximately { 1000, ")
+            && Catch::Matchers::EndsWith(" } +- (0.0078125 * max(|lhs|, |rhs|))"));
+
+    const auto [expectedResult, value] = GENERATE(
+        (table<bool, T>({
+            { true,                               T{1007}},
+            { true,                                T{993}},
+            {false,                               T{1009}},
+            {false,                                T{991}},
+            {false,  std::numeric_limits<T>::infinity()},
+            {false, std::numeric_limits<T>::quiet_NaN()}
+    })));
+    const std::size_t index = GENERATE(0u, 100u, 149u);
+    CAPTURE(value, index);
+
+    std::vector target{expected};
+    target[index] = value;
+    REQUIRE(expectedResult == matcher.matches(target));
+
+    const auto invertedMatcher = !matches::range::approx_rel(expected);
+    REQUIRE_THAT(
+        invertedMatcher.describe(),
+        Catch::Matchers::StartsWith("elements are not approximately { 1000, "));
+    REQUIRE(!invertedMatcher.matches(expected));
+    REQUIRE(invertedMatcher.matches(target));
+}
+
+TEMPLATE_TEST_CASE(
+    "matches::range::approx_rel never matches non-finite expected elements.",
+    "[matcher][matcher::range]",
+    float,
+    double,
+    long double)
+{
+    using T = TestType;
+
+    const T nonFinite = GENERATE(
+        std::numeric_limits<T>::infinity(),
+        -std::numeric_limits<T>::infinity(),
+        std::numeric_limits<T>::quiet_NaN());
+    const T value = GENERATE(
+        T{0},
+        T{1},
+        std::numeric_limits<T>::max(),
+        -std::numeric_limits<T>::max(),
+        std::numeric_limits<T>::infinity(),
+        -std::numeric_limits<T>::infinity());
+    const std::size_t index = GENERATE(0u, 100u, 149u);
+    CAPTURE(nonFinite, value, index);
+
+    std::vector<T> expected(150u, T{1});
+    expected[index] = nonFinite;
+    const auto matcher = matches::range::approx_rel(expected, T{0.0078125});
+
+    std::vector target{expected};
+    target[index] = value;
+    REQUIRE(!matcher.matches(target));
+    REQUIRE(!matcher.matches(expected));
+}
+
+TEMPLATE_TEST_CASE(
+    "matches::range::approx_ulp compares floating-point ranges element-wise by their representation distance.",
+    "[matcher][matcher::range]",
+    float,
+    double)
+{
+    using T = TestType;
+
+    const std::vector expected{T{-1}, T{0}, T{1}, T{1e30}};
+    const auto matcher = matches::range::approx_ulp(expected, 2u);
+
+    REQUIRE_THAT(
+        matcher.describe(),
+        Catch::Matchers::Equals("elements are approximately { -1, 0, 1, 1e+30 } within 2 ULPs"));
+    REQUIRE(matcher.matches(expected));
+
+    const auto step = [](T value, const int count) {
+        for (int i{}; i < std::abs(count); ++i)
+        {
+            value = std::nextafter(value, 0 < count ? std::numeric_limits<T>::infinity() : -std::numeric_limits<T>::infinity());
+        }
+        return value;
+    };
+
+    const std::size_t index = GENERATE(0u, 1u, 2u, 3u);
+    CAPTURE(index);
+
+    std::vector target{expected};
+
+    SECTION("When elements are within the distance.")
+    {
+        const int count = GENERATE(-2, -1, 1, 2);
+        CAPTURE(count);
+
+        target[index] = step(target[index], count);
+        REQUIRE(matcher.matches(target));
+    }
+
+    SECTION("When elements exceed the distance.")
+    {
+        const int count = GENERATE(-3, 3);
+        CAPTURE(count);
+
+        target[index] = step(target[index], count);
+        REQUIRE(!matcher.matches(target));
+    }
+
+    SECTION("When elements are not a number.")
+    {
+        target[index] = std::numeric_limits<T>::quiet_NaN();
+        REQUIRE(!matcher.matches(target));
+    }
+}
+
+TEST_CASE(
+    "matches::range::approx_ulp treats both zeros as equal.",
+    "[matcher][matcher::range]")
+{
+    const std::vector expected{0.f};
+
+    const std::vector target{-0.f};
+    REQUIRE(matches::range::approx_ulp(expected, 0u).matches(target));
+
+    const std::vector denormTarget{-std::numeric_limits<float>::denorm_min()};
+    REQUIRE(matches::range::approx_ulp(expected, 1u).matches(denormTarget));
+    REQUIRE(!matches::range::approx_ulp(expected, 0u).matches(denormTarget));
+}
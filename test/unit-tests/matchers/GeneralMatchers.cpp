@@ -7,6 +7,8 @@
 
 #include <TestTypes.hpp>
 
+#include <vector>
+
 using namespace mimicpp;
 
 namespace
@@ -644,3 +646,84 @@ TEST_CASE(
         }
     }
 }
+
+namespace
+{
+    struct CountedPrintable
+    {
+        inline static int printCallCounter{0};
+    };
+}
+
+template <>
+class custom::Printer<CountedPrintable>
+{
+public:
+    static auto print(print_iterator auto out, const CountedPrintable&)
+    {
+        ++CountedPrintable::printCallCounter;
+        return format::format_to(std::move(out), "CountedPrintable");
+    }
+};
+
+TEST_CASE(
+    "matcher::PredicateMatcher prints its arguments through the active print-cache.",
+    "[matcher]")
+{
+    CountedPrintable::printCallCounter = 0;
+
+    const CountedPrintable value{};
+    const PredicateMatcher matcher{
+        [](auto&&...) { return true; },
+        "is {}",
+        "is not {}",
+        std::make_tuple(std::cref(value))};
+    const PredicateMatcher otherMatcher{
+        [](auto&&...) { return true; },
+        "equals {}",
+        "not equals {}",
+        std::make_tuple(std::cref(value))};
+
+    SECTION("When no cache is active, the arguments are printed each time.")
+    {
+        REQUIRE("is CountedPrintable" == matcher.describe());
+        REQUIRE("equals CountedPrintable" == otherMatcher.describe());
+        REQUIRE(2 == CountedPrintable::printCallCounter);
+    }
+
+    SECTION("When a cache is active, each referred object of owned matchers is printed once.")
+    {
+        const detail::PrintCacheScope scope{};
+        detail::PrintCacheScope::current()->register_owner(matcher);
+        detail::PrintCacheScope::current()->register_owner(otherMatcher);
+
+        REQUIRE("is CountedPrintable" == matcher.describe());
+        REQUIRE("equals CountedPrintable" == otherMatcher.describe());
+        REQUIRE("is CountedPrintable" == matcher.describe());
+        REQUIRE(1 == CountedPrintable::printCallCounter);
+    }
+
+    SECTION("When a cache is active, the arguments of not owned matchers are printed each time.")
+    {
+        const detail::PrintCacheScope scope{};
+
+        REQUIRE("is CountedPrintable" == matcher.describe());
+        REQUIRE("equals CountedPrintable" == otherMatcher.describe());
+        REQUIRE(2 == CountedPrintable::printCallCounter);
+    }
+}
+
+TEST_CASE(
+    "matcher::PredicateMatcher does not cache the arguments of temporaries.",
+    "[matcher]")
+{
+    const detail::PrintCacheScope scope{};
+
+    // both temporaries are likely to occupy the same storage
+    const auto describe = [](const int value) {
+        return StringT{matches::eq(std::vector{value}).describe()};
+    };
+
+    REQUIRE("== { 1 }" == describe(1));
+    REQUIRE("== { 2 }" == describe(2));
+}
@@ -7,6 +7,15 @@
 
 #include "TestTypes.hpp"
 
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#ifdef MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS
+    #include <execution>
+#endif
+
 using namespace mimicpp;
 
 TEST_CASE(
@@ -228,6 +237,113 @@ TEST_CASE(
     }
 }
 
+TEMPLATE_TEST_CASE(
+    "matches::range::unordered_eq supports different strategies.",
+    "[matcher][matcher::range]",
+    matches::range::unordered_strategy::pairwise_t,
+    matches::range::unordered_strategy::hashed_t,
+    matches::range::unordered_strategy::sorted_t)
+{
+    constexpr TestType strategy{};
+
+    SECTION("When an empty range is stored.")
+    {
+        const auto matcher = matches::range::unordered_eq(std::vector<int>{}, strategy);
+
+        REQUIRE_THAT(
+            matcher.describe(),
+            Catch::Matchers::Equals("is a permutation of {  }"));
+
+        const std::vector<int> emptyTarget{};
+        REQUIRE(matcher.matches(emptyTarget));
+
+        const std::vector target{42};
+        REQUIRE(!matcher.matches(target));
+    }
+
+    SECTION("When a non-empty range is stored.")
+    {
+        const auto matcher = matches::range::unordered_eq(std::vector{1337, 42, 42}, strategy);
+
+        REQUIRE_THAT(
+            matcher.describe(),
+            Catch::Matchers::Equals("is a permutation of { 1337, 42, 42 }"));
+
+        const auto [expected, target] = GENERATE(
+            (table<bool, std::vector<int>>({
+                { true, {1337, 42, 42}},
+                { true, {42, 1337, 42}},
+                { true, {42, 42, 1337}},
+                {false,     {1337, 42}},
+                {false, {1337, 1337, 42}},
+                {false, {1337, 42, 42, 42}},
+                {false, {1337, 42, -42}}
+        })));
+        CAPTURE(target);
+
+        REQUIRE(expected == matcher.matches(target));
+
+        const auto invertedMatcher = !matches::range::unordered_eq(std::vector{1337, 42, 42}, strategy);
+        REQUIRE(expected == !invertedMatcher.matches(target));
+    }
+
+    SECTION("When the ranges yield prvalues.")
+    {
+        const auto matcher = matches::range::unordered_eq(std::views::iota(0, 5), strategy);
+
+        const auto match = std::views::iota(0, 5) | std::views::reverse;
+        REQUIRE(matcher.matches(match));
+
+        const auto mismatch = std::views::iota(1, 6);
+        REQUIRE(!matcher.matches(mismatch));
+    }
+}
+
+TEST_CASE(
+    "matches::range::unordered_eq selects a strategy for the default comparator.",
+    "[matcher][matcher::range]")
+{
+    SECTION("Hashable element-types are supported.")
+    {
+        const auto matcher = matches::range::unordered_eq(std::vector<std::string>{"Hello", "World", "Hello"});
+
+        const std::vector<std::string> match{"World", "Hello", "Hello"};
+        REQUIRE(matcher.matches(match));
+
+        const std::vector<std::string> mismatch{"World", "World", "Hello"};
+        REQUIRE(!matcher.matches(mismatch));
+    }
+
+    SECTION("Element-types, which are neither hashable nor ordered, are supported.")
+    {
+        struct Value
+        {
+            int value;
+
+            bool operator==(const Value&) const = default;
+        };
+
+        const auto matcher = matches::range::unordered_eq(std::vector<Value>{{1}, {2}, {1}});
+
+        const std::vector<Value> match{{2}, {1}, {1}};
+        REQUIRE(matcher.matches(match));
+
+        const std::vector<Value> mismatch{{2}, {2}, {1}};
+        REQUIRE(!matcher.matches(mismatch));
+    }
+
+    SECTION("Ranges with different element-types are supported.")
+    {
+        const auto matcher = matches::range::unordered_eq(std::vector<long>{1, 2, 1});
+
+        const std::vector match{2, 1, 1};
+        REQUIRE(matcher.matches(match));
+
+        const std::vector mismatch{2, 2, 1};
+        REQUIRE(!matcher.matches(mismatch));
+    }
+}
+
 TEST_CASE(
     "matches::range::is_sorted matches when target range is sorted.",
     "[matcher][matcher::range]")
@@ -534,3 +650,75 @@ TEST_CASE(
         }
     }
 }
+
+#ifdef MIMICPP_CONFIG_PARALLEL_RANGE_MATCHERS
+
+TEST_CASE(
+    "Range matchers accept execution policies.",
+    "[matcher][matcher::range]")
+{
+    // must exceed the threshold, as the policy is ignored otherwise
+    std::vector<int> target(2 * matches::detail::parallelThreshold);
+    std::iota(target.begin(), target.end(), 0);
+
+    SECTION("matches::range::eq")
+    {
+        const auto matcher = matches::range::eq(std::execution::par_unseq, std::vector{target});
+        REQUIRE_THAT(
+            matcher.describe(),
+            Catch::Matchers::EndsWith("} (parallel unsequenced execution)"));
+        REQUIRE(matcher.matches(target));
+
+        target.back() = -1;
+        REQUIRE(!matcher.matches(target));
+    }
+
+    SECTION("matches::range::is_sorted")
+    {
+        const auto matcher = matches::range::is_sorted(std::execution::par);
+        REQUIRE_THAT(
+            matcher.describe(),
+            Catch::Matchers::Equals("is a sorted range (parallel execution)"));
+        REQUIRE(matcher.matches(target));
+
+        std::ranges::swap(target.front(), target.back());
+        REQUIRE(!matcher.matches(target));
+    }
+
+    SECTION("matches::range::each_element")
+    {
+        const auto matcher = matches::range::each_element(std::execution::par, matches::ge(0));
+        REQUIRE_THAT(
+            matcher.describe(),
+            Catch::Matchers::Equals("each el in range: el >= 0 (parallel execution)"));
+        REQUIRE(matcher.matches(target));
+
+        target[target.size() / 2u] = -1;
+        REQUIRE(!matcher.matches(target));
+    }
+
+    SECTION("matches::range::any_element")
+    {
+        const auto matcher = !matches::range::any_element(std::execution::seq, matches::lt(0));
+        REQUIRE_THAT(
+            matcher.describe(),
+            Catch::Matchers::Equals("none el in range: el < 0 (sequenced execution)"));
+        REQUIRE(matcher.matches(target));
+
+        target[target.size() / 2u] = -1;
+        REQUIRE(!matcher.matches(target));
+    }
+
+    SECTION("Small and non-random-access ranges are inspected sequentially.")
+    {
+        const auto matcher = matches::range::each_element(std::execution::par, matches::ge(0));
+
+        const std::vector small{1, 2, 3};
+        REQUIRE(matcher.matches(small));
+
+        const auto iota = std::views::iota(0, 100'000);
+        REQUIRE(matcher.matches(iota));
+    }
+}
+
+#endif
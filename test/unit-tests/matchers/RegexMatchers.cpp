@@ -0,0 +1,139 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/matchers/RegexMatchers.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace matches = mimicpp::matches;
+namespace Matches = Catch::Matchers;
+
+TEMPLATE_TEST_CASE(
+    "matches::str::regex matches, when the whole target matches the expression.",
+    "[matcher][matcher::str][matcher::str::regex]",
+    const char*,
+    std::string,
+    std::string_view)
+{
+    const auto [expected, target] = GENERATE(
+        (table<bool, std::string>({
+            { true,     "Hello, World!"},
+            { true,           "Hi, Me!"},
+            {false,      "Hello, World"},
+            {false,   " Hello, World!"},
+            {false,     "hello, world?"},
+            {false,                  ""}
+    })));
+    CAPTURE(target);
+
+    const TestType pattern{R"(\w+, \w+!)"};
+    const std::string_view targetView{target};
+
+    SECTION("When plain matcher is used.")
+    {
+        const auto matcher = matches::str::regex(pattern);
+        REQUIRE_THAT(
+            matcher.describe(),
+            Matches::Equals(R"(matches regex "\w+, \w+!")"));
+        REQUIRE(expected == matcher.matches(targetView));
+    }
+
+    SECTION("When inverted matcher is used.")
+    {
+        const auto matcher = !matches::str::regex(pattern);
+        REQUIRE_THAT(
+            matcher.describe(),
+            Matches::Equals(R"(does not match regex "\w+, \w+!")"));
+        REQUIRE(expected == !matcher.matches(targetView));
+    }
+}
+
+TEST_CASE(
+    "matches::str::regex case-insensitive overload ignores the case.",
+    "[matcher][matcher::str][matcher::str::regex]")
+{
+    const auto matcher = matches::str::regex("hello, [a-z]+!", mimicpp::case_insensitive);
+    REQUIRE_THAT(
+        matcher.describe(),
+        Matches::Equals(R"(case-insensitively matches regex "hello, [a-z]+!")"));
+
+    const std::string match{"HeLLo, World!"};
+    REQUIRE(matcher.matches(match));
+
+    const std::string mismatch{"Hello, World?"};
+    REQUIRE(!matcher.matches(mismatch));
+
+    const auto invertedMatcher = !matches::str::regex("hello", mimicpp::case_insensitive);
+    REQUIRE_THAT(
+        invertedMatcher.describe(),
+        Matches::Equals(R"(case-insensitively does not match regex "hello")"));
+    const std::string_view target{"HELLO"};
+    REQUIRE(!invertedMatcher.matches(target));
+}
+
+TEST_CASE(
+    "matches::str::regex options overload compiles the expression with the given options.",
+    "[matcher][matcher::str][matcher::str::regex]")
+{
+#ifdef MIMICPP_CONFIG_USE_RE2
+    mimicpp::matches::str::RegexOptionsT caseInsensitive{};
+    caseInsensitive.set_case_sensitive(false);
+    mimicpp::matches::str::RegexOptionsT literal{};
+    literal.set_literal(true);
+#else
+    constexpr mimicpp::matches::str::RegexOptionsT caseInsensitive = std::regex::ECMAScript | std::regex::icase;
+    // In basic POSIX grammar, + is an ordinary character.
+    constexpr mimicpp::matches::str::RegexOptionsT literal = std::regex::basic;
+#endif
+
+    SECTION("When case-insensitive options are given.")
+    {
+        const auto matcher = matches::str::regex("hello, [a-z]+!", caseInsensitive);
+        REQUIRE_THAT(
+            matcher.describe(),
+            Matches::Equals(R"(case-insensitively matches regex "hello, [a-z]+!")"));
+
+        const std::string match{"HeLLo, World!"};
+        REQUIRE(matcher.matches(match));
+    }
+
+    SECTION("When the options change the interpretation of the expression.")
+    {
+        const auto matcher = matches::str::regex("a+", literal);
+        REQUIRE_THAT(
+            matcher.describe(),
+            Matches::Equals(R"(matches regex "a+")"));
+
+        const std::string match{"a+"};
+        REQUIRE(matcher.matches(match));
+        const std::string mismatch{"aa"};
+        REQUIRE(!matcher.matches(mismatch));
+    }
+}
+
+TEST_CASE(
+    "matches::str::regex reports invalid expressions during construction.",
+    "[matcher][matcher::str][matcher::str::regex]")
+{
+    REQUIRE_THROWS_AS(
+        matches::str::regex("(unbalanced"),
+        std::runtime_error);
+}
+
+TEST_CASE(
+    "matches::str::regex can be copied and inverted.",
+    "[matcher][matcher::str][matcher::str::regex]")
+{
+    const auto matcher = matches::str::regex("a+b");
+    const auto copy = matcher;
+    const auto inverted = !matcher;
+
+    const std::string target{"aaab"};
+    REQUIRE(matcher.matches(target));
+    REQUIRE(copy.matches(target));
+    REQUIRE(!inverted.matches(target));
+}
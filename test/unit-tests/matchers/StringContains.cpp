@@ -5,7 +5,13 @@
 
 #include "mimic++/matchers/StringMatchers.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cctype>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <string_view>
 
 namespace matches = mimicpp::matches;
 namespace Matches = Catch::Matchers;
@@ -322,6 +328,129 @@ TEMPLATE_TEST_CASE(
         mismatches);
 }
 
+TEMPLATE_TEST_CASE(
+    "matches::str::contains finds the pattern at any position in long targets.",
+    "[matcher][matcher::str]",
+    char,
+    char8_t,
+    wchar_t,
+    char32_t)
+{
+    using StringT = std::basic_string<TestType>;
+
+    // the repeated first element forces many candidates, which must be rejected
+    const StringT pattern{
+        static_cast<TestType>('a'),
+        static_cast<TestType>('a'),
+        static_cast<TestType>('b')};
+    const auto matcher = matches::str::contains(pattern);
+
+    StringT target(4096u, static_cast<TestType>('a'));
+    REQUIRE(!matcher.matches(target));
+
+    const std::size_t index = GENERATE(0u, 1u, 2047u, 4093u);
+    CAPTURE(index);
+    target.replace(index, pattern.size(), pattern);
+    REQUIRE(matcher.matches(target));
+
+    const std::basic_string_view<TestType> view{target};
+    const auto prefix = view.substr(0u, index + 2u);
+    REQUIRE(!matcher.matches(prefix));
+    const auto suffix = view.substr(index + 1u);
+    REQUIRE(!matcher.matches(suffix));
+}
+
+TEMPLATE_TEST_CASE(
+    "matches::str::contains agrees with a naive search for long patterns.",
+    "[matcher][matcher::str]",
+    char,
+    wchar_t,
+    char32_t)
+{
+    using StringT = std::basic_string<TestType>;
+
+    // Elements, which share the lowest byte, fall into the same bucket of the search-table.
+    const auto makeElement = [](const std::size_t i) {
+        if constexpr (1u < sizeof(TestType))
+        {
+            return static_cast<TestType>(0x41u + (i % 5u) + 0x100u * (i % 3u));
+        }
+        else
+        {
+            return static_cast<TestType>('A' + i % 5u);
+        }
+    };
+
+    StringT target{};
+    for (const std::size_t i : std::views::iota(0u, 2048u))
+    {
+        target.push_back(makeElement(i * 7u % 11u));
+    }
+
+    const std::size_t length = GENERATE(16u, 17u, 32u, 100u);
+    const std::size_t offset = GENERATE(0u, 1u, 1000u);
+    CAPTURE(length, offset);
+
+    StringT pattern = target.substr(offset, length);
+    CHECK(matches::str::contains(pattern).matches(target));
+
+    pattern.back() = makeElement(pattern.back() == makeElement(0u) ? 1u : 0u);
+    const bool expected = !std::ranges::empty(std::ranges::search(target, pattern));
+    CHECK(expected == matches::str::contains(pattern).matches(target));
+
+    // modifies the last element, so that just its bucket collides
+    if constexpr (1u < sizeof(TestType))
+    {
+        pattern = target.substr(offset, length);
+        pattern.back() = static_cast<TestType>(pattern.back() + 0x1000u);
+        CHECK(!matches::str::contains(pattern).matches(target));
+    }
+}
+
+TEMPLATE_TEST_CASE(
+    "matches::str::contains search-table supports empty patterns.",
+    "[matcher][matcher::str]",
+    char,
+    wchar_t,
+    char32_t)
+{
+    // Out of bounds accesses are not allowed during constant evaluation, thus this would not compile otherwise.
+    [[maybe_unused]] constexpr matches::detail::HorspoolTable<TestType> table{nullptr, 0u};
+
+    const std::basic_string<TestType> pattern{};
+    const std::basic_string<TestType> target(32u, static_cast<TestType>('a'));
+    REQUIRE(matches::str::contains(pattern).matches(target));
+    REQUIRE(!(!matches::str::contains(pattern)).matches(target));
+}
+
+TEMPLATE_TEST_CASE(
+    "matches::str::contains allocates the search-table just for long patterns.",
+    "[matcher][matcher::str]",
+    char,
+    wchar_t,
+    char32_t)
+{
+    using StringT = std::basic_string<TestType>;
+    STATIC_REQUIRE(sizeof(matches::detail::SearchablePattern<StringT>) < sizeof(matches::detail::HorspoolTable<TestType>));
+
+    const std::size_t length = GENERATE(
+        matches::detail::horspoolThreshold - 1u,
+        matches::detail::horspoolThreshold);
+    CAPTURE(length);
+
+    const StringT pattern(length, static_cast<TestType>('a'));
+    const matches::detail::SearchablePattern<StringT> searchable{pattern};
+    StringT target(32u, static_cast<TestType>('b'));
+    REQUIRE(!searchable.is_part_of(target));
+
+    std::ranges::copy(pattern, target.begin() + 7);
+    REQUIRE(searchable.is_part_of(target));
+
+    // copies share the table
+    const auto copy{searchable};
+    REQUIRE(copy.is_part_of(target));
+}
+
 TEST_CASE(
     "matches::str::contains case-insensitive overload supports empty strings.",
     "[matcher][matcher::str]")
@@ -646,3 +775,37 @@ TEMPLATE_TEST_CASE(
 }
 
 #endif
+
+TEST_CASE(
+    "matches::str::contains case-insensitive overload finds the pattern at any position in long targets.",
+    "[matcher][matcher::str]")
+{
+    const std::string pattern = GENERATE(
+        std::string{"aAb"},
+        std::string{"The Quick Brown Fox Jumps Over The Lazy Dog"});
+    CAPTURE(pattern);
+
+    const auto matcher = matches::str::contains(pattern, mimicpp::case_insensitive);
+
+    std::string target(4096u, 'A');
+    REQUIRE(!matcher.matches(target));
+
+    std::string inverted{};
+    std::ranges::transform(
+        pattern,
+        std::back_inserter(inverted),
+        [](const char c) {
+            return static_cast<char>(
+                std::isupper(static_cast<unsigned char>(c))
+                    ? std::tolower(static_cast<unsigned char>(c))
+                    : std::toupper(static_cast<unsigned char>(c)));
+        });
+
+    const std::size_t index = GENERATE(0u, 1u, 2047u);
+    CAPTURE(index);
+    target.replace(index, inverted.size(), inverted);
+    REQUIRE(matcher.matches(target));
+
+    target.replace(index + inverted.size() - 1u, 1u, "#");
+    REQUIRE(!matcher.matches(target));
+}
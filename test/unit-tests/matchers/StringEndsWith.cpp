@@ -6,6 +6,9 @@
 #include "mimic++/matchers/StringMatchers.hpp"
 
 #include <array>
+#include <ranges>
+#include <string>
+#include <string_view>
 
 namespace matches = mimicpp::matches;
 namespace Matches = Catch::Matchers;
@@ -655,4 +658,43 @@ TEMPLATE_TEST_CASE(
         mismatches);
 }
 
+TEST_CASE(
+    "matches::str::ends_with case-insensitive overload compares long utf8-strings piece by piece.",
+    "[matcher][matcher::str]")
+{
+    std::u8string pattern{};
+    std::u8string target{};
+    for ([[maybe_unused]] const int i : std::views::iota(0, 50))
+    {
+        pattern += u8" Stra\u00DFe";
+        target += u8" STRASSE";
+    }
+
+    REQUIRE(matches::str::ends_with(pattern, mimicpp::case_insensitive).matches(target));
+    REQUIRE(matches::str::ends_with(std::u8string_view{pattern}.substr(301u), mimicpp::case_insensitive).matches(target));
+    REQUIRE(!matches::str::ends_with(u8"a" + pattern, mimicpp::case_insensitive).matches(target));
+
+    target[42u] = u8'!';
+    REQUIRE(!matches::str::ends_with(pattern, mimicpp::case_insensitive).matches(target));
+}
+
+TEST_CASE(
+    "matches::str::ends_with case-insensitive overload folds utf16 surrogate pairs at the chunk boundaries as a whole.",
+    "[matcher][matcher::str]")
+{
+    // U+10400 folds to U+10428; both are encoded as surrogate pairs.
+    // With an offset of 63, the pair crosses the boundary of the first chunk.
+    const std::size_t offset = GENERATE(62u, 63u);
+    CAPTURE(offset);
+
+    std::u16string pattern{u"\U00010428"};
+    pattern.append(offset, u'b');
+
+    std::u16string target(100u, u'A');
+    target += u"\U00010400";
+    target.append(offset, u'B');
+
+    REQUIRE(matches::str::ends_with(pattern, mimicpp::case_insensitive).matches(target));
+}
+
 #endif
@@ -5,7 +5,11 @@
 
 #include "mimic++/matchers/StringMatchers.hpp"
 
+#include <algorithm>
 #include <array>
+#include <ranges>
+#include <string>
+#include <string_view>
 
 namespace matches = mimicpp::matches;
 namespace Matches = Catch::Matchers;
@@ -599,4 +603,148 @@ TEMPLATE_TEST_CASE(
         mismatches);
 }
 
+TEST_CASE(
+    "matches::str::eq case-insensitive overload compares long utf8-strings piece by piece.",
+    "[matcher][matcher::str]")
+{
+    // the sharp s expands to two code-units during the case-folding, thus the pieces are shifted against each other
+    std::u8string pattern{};
+    std::u8string target{};
+    for ([[maybe_unused]] const int i : std::views::iota(0, 50))
+    {
+        pattern += u8"Stra\u00DFe ";
+        target += u8"STRASSE ";
+    }
+
+    REQUIRE(matches::str::eq(pattern, mimicpp::case_insensitive).matches(target));
+    REQUIRE(matches::str::eq(target, mimicpp::case_insensitive).matches(pattern));
+
+    target.back() = u8'!';
+    REQUIRE(!matches::str::eq(pattern, mimicpp::case_insensitive).matches(target));
+
+    target.pop_back();
+    REQUIRE(!matches::str::eq(pattern, mimicpp::case_insensitive).matches(target));
+}
+
+TEST_CASE(
+    "matches::detail::for_each_folded_chunk never splits code-points at the chunk boundaries.",
+    "[matcher][matcher::str]")
+{
+    using ConverterT = mimicpp::string_case_fold_converter<char8_t>;
+
+    // The first chunk spans 64 code-units from either end.
+    // Depending on the offset, the sharp s (2 code-units) or the euro sign (3 code-units) cross that boundary.
+    const std::size_t offset = GENERATE(61u, 62u, 63u);
+    CAPTURE(offset);
+
+    std::u8string str(offset, u8'A');
+    str += u8"\u00DF\u20AC";
+    str.append(200u, u8'B');
+    str += u8"\u20AC\u00DF";
+    str.append(offset, u8'C');
+
+    const std::u8string_view view{str};
+    const std::u8string expected = ConverterT{}(view);
+
+    SECTION("When folded from the front.")
+    {
+        std::u8string folded{};
+        matches::detail::for_each_folded_chunk<false>(
+            view,
+            [&](const auto& chunk) {
+                folded.append(std::ranges::begin(chunk), std::ranges::end(chunk));
+                return true;
+            });
+
+        REQUIRE(expected == folded);
+    }
+
+    SECTION("When folded from the back.")
+    {
+        std::u8string folded{};
+        matches::detail::for_each_folded_chunk<true>(
+            view,
+            [&](const auto& chunk) {
+                folded.insert(folded.begin(), std::ranges::begin(chunk), std::ranges::end(chunk));
+                return true;
+            });
+
+        REQUIRE(expected == folded);
+    }
+}
+
+TEST_CASE(
+    "matches::detail::for_each_folded_chunk visits malformed utf8-strings exactly once.",
+    "[matcher][matcher::str]")
+{
+    using ConverterT = mimicpp::string_case_fold_converter<char8_t>;
+
+    // The continuation bytes exceed the chunk length, thus the code-point boundary can't be found within a chunk.
+    const std::size_t prefixLength = GENERATE(0u, 1u, 63u, 64u, 65u);
+    CAPTURE(prefixLength);
+
+    std::u8string str(prefixLength, u8'A');
+    str.append(500u, static_cast<char8_t>(0x80u));
+    str.append(100u, u8'B');
+
+    const std::u8string_view view{str};
+    const std::u8string expected = ConverterT{}(view);
+
+    std::u8string folded{};
+    matches::detail::for_each_folded_chunk<false>(
+        view,
+        [&](const auto& chunk) {
+            folded.append(std::ranges::begin(chunk), std::ranges::end(chunk));
+            return true;
+        });
+
+    REQUIRE(expected == folded);
+}
+
+TEST_CASE(
+    "matches::str::eq case-insensitive overload folds utf16 surrogate pairs at the chunk boundaries as a whole.",
+    "[matcher][matcher::str]")
+{
+    // U+10400 folds to U+10428; both are encoded as surrogate pairs.
+    // With an offset of 63, the pair crosses the boundary of the first chunk.
+    const std::size_t offset = GENERATE(62u, 63u);
+    CAPTURE(offset);
+
+    std::u16string pattern(offset, u'a');
+    pattern += u"\U00010428";
+    pattern.append(100u, u'b');
+
+    std::u16string target(offset, u'A');
+    target += u"\U00010400";
+    target.append(100u, u'B');
+
+    REQUIRE(matches::str::eq(pattern, mimicpp::case_insensitive).matches(target));
+    REQUIRE(matches::str::eq(target, mimicpp::case_insensitive).matches(pattern));
+}
+
 #endif
+
+TEST_CASE(
+    "matches::str::eq case-insensitive overload compares long strings.",
+    "[matcher][matcher::str]")
+{
+    std::string pattern{};
+    for (const std::size_t i : std::views::iota(0u, 100u))
+    {
+        pattern.push_back(static_cast<char>('a' + i % 26u));
+    }
+
+    const auto matcher = matches::str::eq(pattern, mimicpp::case_insensitive);
+
+    std::string target = pattern;
+    std::ranges::transform(target, target.begin(), [](const char c) { return static_cast<char>(c - 'a' + 'A'); });
+    REQUIRE(matcher.matches(target));
+
+    const std::size_t index = GENERATE(0u, 31u, 32u, 63u, 99u);
+    CAPTURE(index);
+    target[index] = '@';
+    REQUIRE(!matcher.matches(target));
+
+    target.pop_back();
+    REQUIRE(!matcher.matches(target));
+}
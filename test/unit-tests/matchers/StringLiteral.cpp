@@ -0,0 +1,142 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/matchers/StringMatchers.hpp"
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace matches = mimicpp::matches;
+namespace Matches = Catch::Matchers;
+
+namespace
+{
+    class CustomString
+    {
+    public:
+        std::string inner{};
+    };
+}
+
+template <>
+struct mimicpp::string_traits<CustomString>
+{
+    using char_t = char;
+
+    [[nodiscard]]
+    static constexpr std::span<const char> view(const CustomString& str) noexcept
+    {
+        return std::span{str.inner};
+    }
+};
+
+TEST_CASE(
+    "Literal string matchers are stateless.",
+    "[matcher][matcher::str]")
+{
+    STATIC_REQUIRE(std::is_empty_v<decltype(matches::str::eq<"Hello">())>);
+    STATIC_REQUIRE(std::is_empty_v<decltype(!matches::str::contains<"Hello">())>);
+
+    STATIC_REQUIRE(mimicpp::matcher_for<decltype(matches::str::eq<"Hello">()), std::string>);
+    STATIC_REQUIRE(mimicpp::matcher_for<decltype(matches::str::starts_with<"Hello">()), const char*>);
+    STATIC_REQUIRE(mimicpp::matcher_for<decltype(matches::str::ends_with<"Hello">()), std::string_view>);
+}
+
+TEST_CASE(
+    "Literal string matchers build their descriptions during compile-time.",
+    "[matcher][matcher::str]")
+{
+    STATIC_REQUIRE("is equal to \"Hello\"" == matches::str::eq<"Hello">().describe());
+    STATIC_REQUIRE("is not equal to \"\"" == (!matches::str::eq<"">()).describe());
+    STATIC_REQUIRE("starts with \"Hello\"" == matches::str::starts_with<"Hello">().describe());
+    STATIC_REQUIRE("starts not with \"Hello\"" == (!matches::str::starts_with<"Hello">()).describe());
+    STATIC_REQUIRE("ends with \"Hello\"" == matches::str::ends_with<"Hello">().describe());
+    STATIC_REQUIRE("ends not with \"Hello\"" == (!matches::str::ends_with<"Hello">()).describe());
+    STATIC_REQUIRE("contains \"Hello\"" == matches::str::contains<"Hello">().describe());
+    STATIC_REQUIRE("contains not \"Hello\"" == (!matches::str::contains<"Hello">()).describe());
+}
+
+TEST_CASE(
+    "Literal string matchers can be evaluated during compile-time.",
+    "[matcher][matcher::str]")
+{
+    constexpr auto check = [](const auto& matcher, std::string_view target) {
+        return matcher.matches(target);
+    };
+
+    STATIC_REQUIRE(check(matches::str::eq<"Hello">(), "Hello"));
+    STATIC_REQUIRE(!check(matches::str::eq<"Hello">(), "Hello!"));
+    STATIC_REQUIRE(check(matches::str::starts_with<"Hello">(), "Hello, World!"));
+    STATIC_REQUIRE(check(matches::str::ends_with<"World!">(), "Hello, World!"));
+    STATIC_REQUIRE(check(matches::str::contains<"o, W">(), "Hello, World!"));
+    STATIC_REQUIRE(check(matches::str::contains<"Hello, World! Hello, World!">(), "Hello, World! Hello, World!"));
+}
+
+TEMPLATE_TEST_CASE(
+    "Literal string matchers agree with their runtime counterparts.",
+    "[matcher][matcher::str]",
+    const char*,
+    std::string,
+    std::string_view)
+{
+    const std::string source = GENERATE(
+        "",
+        "Hello",
+        "Hello, World!",
+        "hello, world!",
+        "Hello, World! Hello, Everybody!",
+        "Say Hello, World! to everybody, who is around.");
+    CAPTURE(source);
+
+    TestType target{source.c_str()};
+
+    SECTION("For short patterns.")
+    {
+        REQUIRE(matches::str::eq("Hello, World!").matches(target) == matches::str::eq<"Hello, World!">().matches(target));
+        REQUIRE(!matches::str::eq("Hello").matches(target) == (!matches::str::eq<"Hello">()).matches(target));
+        REQUIRE(matches::str::starts_with("Hello").matches(target) == matches::str::starts_with<"Hello">().matches(target));
+        REQUIRE(matches::str::ends_with("World!").matches(target) == matches::str::ends_with<"World!">().matches(target));
+        REQUIRE(matches::str::contains("o, W").matches(target) == matches::str::contains<"o, W">().matches(target));
+        REQUIRE(matches::str::contains("").matches(target) == matches::str::contains<"">().matches(target));
+    }
+
+    SECTION("For long patterns.")
+    {
+        REQUIRE(
+            matches::str::eq("Hello, World! Hello, Everybody!").matches(target)
+            == matches::str::eq<"Hello, World! Hello, Everybody!">().matches(target));
+        REQUIRE(
+            matches::str::starts_with("Say Hello, World! to").matches(target)
+            == matches::str::starts_with<"Say Hello, World! to">().matches(target));
+        REQUIRE(
+            matches::str::ends_with("to everybody, who is around.").matches(target)
+            == matches::str::ends_with<"to everybody, who is around.">().matches(target));
+        REQUIRE(
+            matches::str::contains("Hello, World! to everybody").matches(target)
+            == matches::str::contains<"Hello, World! to everybody">().matches(target));
+    }
+}
+
+TEST_CASE(
+    "Literal string matchers accept the same strings as their runtime counterparts.",
+    "[matcher][matcher::str]")
+{
+    STATIC_REQUIRE(mimicpp::matcher_for<decltype(matches::str::eq<"Hello">()), CustomString>);
+    STATIC_REQUIRE(mimicpp::matcher_for<decltype(matches::str::contains<"Hello">()), CustomString>);
+
+    STATIC_REQUIRE(!mimicpp::matcher_for<decltype(matches::str::eq<"Hello">()), std::wstring>);
+    STATIC_REQUIRE(!mimicpp::matcher_for<decltype(matches::str::starts_with<"Hello">()), const char8_t*>);
+    STATIC_REQUIRE(!mimicpp::matcher_for<decltype(matches::str::contains<"Hello">()), std::u16string_view>);
+
+    const CustomString target{"Hello, World!"};
+    REQUIRE(matches::str::eq("Hello, World!").matches(target));
+    REQUIRE(matches::str::eq<"Hello, World!">().matches(target));
+    REQUIRE(matches::str::starts_with<"Hello">().matches(target));
+    REQUIRE(matches::str::ends_with<"World!">().matches(target));
+    REQUIRE(matches::str::contains<"o, W">().matches(target));
+    REQUIRE(!matches::str::contains<"Hello, World! Hello, World!">().matches(target));
+}
@@ -6,6 +6,9 @@
 #include "mimic++/matchers/StringMatchers.hpp"
 
 #include <array>
+#include <ranges>
+#include <string>
+#include <string_view>
 
 namespace matches = mimicpp::matches;
 namespace Matches = Catch::Matchers;
@@ -655,4 +658,43 @@ TEMPLATE_TEST_CASE(
         mismatches);
 }
 
+TEST_CASE(
+    "matches::str::starts_with case-insensitive overload compares long utf8-strings piece by piece.",
+    "[matcher][matcher::str]")
+{
+    std::u8string pattern{};
+    std::u8string target{};
+    for ([[maybe_unused]] const int i : std::views::iota(0, 50))
+    {
+        pattern += u8"Stra\u00DFe ";
+        target += u8"STRASSE ";
+    }
+
+    REQUIRE(matches::str::starts_with(pattern, mimicpp::case_insensitive).matches(target));
+    REQUIRE(matches::str::starts_with(std::u8string_view{pattern}.substr(0u, 100u), mimicpp::case_insensitive).matches(target));
+    REQUIRE(!matches::str::starts_with(pattern + u8"a", mimicpp::case_insensitive).matches(target));
+
+    target[300u] = u8'!';
+    REQUIRE(!matches::str::starts_with(pattern, mimicpp::case_insensitive).matches(target));
+}
+
+TEST_CASE(
+    "matches::str::starts_with case-insensitive overload folds utf16 surrogate pairs at the chunk boundaries as a whole.",
+    "[matcher][matcher::str]")
+{
+    // U+10400 folds to U+10428; both are encoded as surrogate pairs.
+    // With an offset of 63, the pair crosses the boundary of the first chunk.
+    const std::size_t offset = GENERATE(62u, 63u);
+    CAPTURE(offset);
+
+    std::u16string pattern(offset, u'a');
+    pattern += u"\U00010428";
+
+    std::u16string target(offset, u'A');
+    target += u"\U00010400";
+    target.append(100u, u'B');
+
+    REQUIRE(matches::str::starts_with(pattern, mimicpp::case_insensitive).matches(target));
+}
+
 #endif
@@ -6,6 +6,8 @@
 #include "mimic++/policies/ArgRequirementPolicies.hpp"
 #include "mimic++/Expectation.hpp"
 #include "mimic++/Mock.hpp"
+#include "mimic++/matchers/GeneralMatchers.hpp"
+#include "mimic++/matchers/RangeMatchers.hpp"
 #include "mimic++/policies/FinalizerPolicies.hpp"
 
 #include "TestTypes.hpp"
@@ -318,3 +320,35 @@ TEST_CASE(
         REQUIRE(match == std::as_const(policy).matches(info));
     }
 }
+
+TEST_CASE(
+    "expectation_policies::ArgsRequirement caches only stable descriptions.",
+    "[expectation][expectation::policy]")
+{
+    SECTION("When the matcher owns all its data, the description is built once.")
+    {
+        expectation_policies::ArgsRequirement policy = expect::arg<0>(matches::range::eq(std::vector{1, 2}));
+        STATIC_CHECK(decltype(policy)::cachesDescription);
+        STATIC_CHECK(std::is_lvalue_reference_v<decltype(policy.describe())>);
+
+        CHECK_THAT(
+            policy.describe(),
+            Catch::Matchers::Equals("expect: arg[0] elements are { 1, 2 }"));
+    }
+
+    SECTION("When the matcher refers to user data, the description reflects its current state.")
+    {
+        std::vector elements{1, 2};
+        expectation_policies::ArgsRequirement policy = expect::arg<0>(matches::range::eq(elements));
+        STATIC_CHECK(!decltype(policy)::cachesDescription);
+
+        CHECK_THAT(
+            policy.describe(),
+            Catch::Matchers::Equals("expect: arg[0] elements are { 1, 2 }"));
+
+        elements.emplace_back(3);
+        CHECK_THAT(
+            policy.describe(),
+            Catch::Matchers::Equals("expect: arg[0] elements are { 1, 2, 3 }"));
+    }
+}
@@ -0,0 +1,122 @@
+#          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+# Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          https://www.boost.org/LICENSE_1_0.txt)
+
+# Script-mode amalgamation of the mimic++ headers, which doesn't require any external tool.
+# Usage: cmake -D INCLUDE_DIR=<dir> -D ENTRY_HEADER=<header> -D OUTPUT_FILE=<file> -P Amalgamate.cmake
+#
+# Each internal header (i.e. each quoted include, which is either relative to the including file or to the include dir)
+# is inlined at its first inclusion; subsequent inclusions are dropped. Doxygen comments (``/** ... */``), the per-file license notes and ``#pragma once``
+# directives are removed, as they just add parsing overhead for the consumer.
+# Everything else (including the include-guards and all system includes) is preserved verbatim.
+
+cmake_minimum_required(VERSION 3.15)
+
+foreach (VAR_NAME IN ITEMS INCLUDE_DIR ENTRY_HEADER OUTPUT_FILE)
+    if (NOT DEFINED ${VAR_NAME})
+        message(FATAL_ERROR "mimic++: amalgamate - ${VAR_NAME} is not set.")
+    endif ()
+endforeach ()
+
+# CMake regular expressions do not support lazy quantifiers.
+# Thus, each comment terminator is temporarily replaced by a single marker character, which can then be excluded
+# from the comment body.
+string(ASCII 1 COMMENT_END_MARKER)
+
+function(strip_header_content CONTENT OUT_CONTENT)
+
+    # The license note at the very beginning of each file.
+    string(REGEX REPLACE "^\n//[^\n]*Copyright[^\n]*\n(//[^\n]*\n)*\n*" "\n" CONTENT "${CONTENT}")
+    string(REGEX REPLACE "\n[ \t]*#pragma once[ \t]*\n" "\n" CONTENT "${CONTENT}")
+
+    string(REPLACE "*/" "${COMMENT_END_MARKER}" CONTENT "${CONTENT}")
+    string(REGEX REPLACE
+        "\n[ \t]*/\\*\\*[^${COMMENT_END_MARKER}]*${COMMENT_END_MARKER}[ \t]*\n"
+        "\n"
+        CONTENT
+        "${CONTENT}")
+    string(REPLACE "${COMMENT_END_MARKER}" "*/" CONTENT "${CONTENT}")
+
+    # Doc comments are often surrounded by empty lines, which would pile up otherwise.
+    string(REGEX REPLACE "\n[ \t]*\n([ \t]*\n)+" "\n\n" CONTENT "${CONTENT}")
+
+    set(${OUT_CONTENT} "${CONTENT}" PARENT_SCOPE)
+
+endfunction()
+
+function(resolve_header INCLUDING_HEADER INCLUDED_HEADER OUT_HEADER)
+
+    get_filename_component(INCLUDING_DIR "${INCLUDE_DIR}/${INCLUDING_HEADER}" DIRECTORY)
+    foreach (BASE_DIR IN ITEMS "${INCLUDING_DIR}" "${INCLUDE_DIR}")
+        get_filename_component(CANDIDATE "${INCLUDED_HEADER}" ABSOLUTE BASE_DIR "${BASE_DIR}")
+        if (EXISTS "${CANDIDATE}")
+            file(RELATIVE_PATH RELATIVE_HEADER "${INCLUDE_DIR}" "${CANDIDATE}")
+            set(${OUT_HEADER} "${RELATIVE_HEADER}" PARENT_SCOPE)
+            return()
+        endif ()
+    endforeach ()
+
+    message(FATAL_ERROR "mimic++: amalgamate - Unable to resolve \"${INCLUDED_HEADER}\", included by ${INCLUDING_HEADER}.")
+
+endfunction()
+
+function(amalgamate_header HEADER OUT_CONTENT)
+
+    get_property(VISITED_HEADERS GLOBAL PROPERTY MIMICPP_AMALGAMATE_VISITED_HEADERS)
+    if (HEADER IN_LIST VISITED_HEADERS)
+        set(${OUT_CONTENT} "" PARENT_SCOPE)
+        return()
+    endif ()
+    set_property(GLOBAL APPEND PROPERTY MIMICPP_AMALGAMATE_VISITED_HEADERS "${HEADER}")
+
+    file(READ "${INCLUDE_DIR}/${HEADER}" CONTENT)
+    # Prepending a line-break lets all patterns anchor at line starts, even for the very first line.
+    strip_header_content("\n${CONTENT}" CONTENT)
+
+    set(RESULT "")
+    set(INCLUDE_REGEX "\n[ \t]*#[ \t]*include[ \t]+\"([^\"]+)\"[^\n]*\n")
+    string(REGEX MATCH "${INCLUDE_REGEX}" INCLUDE_DIRECTIVE "${CONTENT}")
+    while (INCLUDE_DIRECTIVE)
+        resolve_header("${HEADER}" "${CMAKE_MATCH_1}" INCLUDED_HEADER)
+        string(FIND "${CONTENT}" "${INCLUDE_DIRECTIVE}" DIRECTIVE_BEGIN)
+        string(LENGTH "${INCLUDE_DIRECTIVE}" DIRECTIVE_LENGTH)
+        # Keep the leading line-break, so that the next directive can still be found at a line start.
+        math(EXPR DIRECTIVE_BEGIN "${DIRECTIVE_BEGIN} + 1")
+        math(EXPR DIRECTIVE_END "${DIRECTIVE_BEGIN} + ${DIRECTIVE_LENGTH} - 2")
+
+        string(SUBSTRING "${CONTENT}" 0 ${DIRECTIVE_BEGIN} PREFIX)
+        string(SUBSTRING "${CONTENT}" ${DIRECTIVE_END} -1 CONTENT)
+
+        amalgamate_header("${INCLUDED_HEADER}" INCLUDED_CONTENT)
+        string(APPEND RESULT "${PREFIX}" "${INCLUDED_CONTENT}")
+
+        string(REGEX MATCH "${INCLUDE_REGEX}" INCLUDE_DIRECTIVE "${CONTENT}")
+    endwhile ()
+    string(APPEND RESULT "${CONTENT}")
+
+    message(VERBOSE "mimic++: amalgamate - Inlined ${HEADER}")
+    set(${OUT_CONTENT} "${RESULT}" PARENT_SCOPE)
+
+endfunction()
+
+get_filename_component(INCLUDE_DIR "${INCLUDE_DIR}" ABSOLUTE)
+amalgamate_header("${ENTRY_HEADER}" AMALGAMATED_CONTENT)
+string(REGEX REPLACE "\n[ \t]*\n([ \t]*\n)+" "\n\n" AMALGAMATED_CONTENT "${AMALGAMATED_CONTENT}")
+string(REGEX REPLACE "^\n+" "" AMALGAMATED_CONTENT "${AMALGAMATED_CONTENT}")
+
+file(READ "${INCLUDE_DIR}/${ENTRY_HEADER}" ENTRY_CONTENT)
+string(REGEX MATCH "^//[^\n]*Copyright[^\n]*\n(//[^\n]*\n)*" LICENSE_NOTE "${ENTRY_CONTENT}")
+
+file(WRITE "${OUTPUT_FILE}.tmp"
+    "${LICENSE_NOTE}"
+    "\n"
+    "// This file is generated from the mimic++ headers. Do not edit it manually.\n"
+    "// The documentation has been stripped; see the individual headers or https://dnkpp.github.io/mimicpp/ instead.\n"
+    "\n"
+    "#pragma once\n"
+    "\n"
+    "${AMALGAMATED_CONTENT}")
+# Keeps the timestamp untouched, if nothing changed.
+configure_file("${OUTPUT_FILE}.tmp" "${OUTPUT_FILE}" COPYONLY)
+file(REMOVE "${OUTPUT_FILE}.tmp")